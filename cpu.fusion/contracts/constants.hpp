@@ -6,6 +6,31 @@ static constexpr int64_t MAX_ASSET_AMOUNT = 4611686018427387903;
 //Symbols
 static constexpr eosio::symbol WAX_SYMBOL = eosio::symbol("WAX", 8);
 
+//Voting
+static constexpr uint64_t SECONDS_BETWEEN_VOTE_CHECKS = 60 * 60 * 24; /* top21 is updated at most once a day */
+static constexpr uint64_t MAX_SECONDS_BETWEEN_VOTES = 60 * 60 * 24 * 7; /* default for state, vote weight only changes weekly */
+
 //Contract names
 static constexpr eosio::name DAPP_CONTRACT = "dapp.fusion"_n;
-static constexpr eosio::name WAX_CONTRACT = "eosio.token"_n;
\ No newline at end of file
+static constexpr eosio::name WAX_CONTRACT = "eosio.token"_n;
+
+//Memos
+enum class MEMO_COMMAND : uint8_t {
+    NONE,
+    STAKE_CPU,
+    UNSTAKE,
+    VOTER_PAY
+};
+
+// the whole memo has to match
+static constexpr memo::memo_commands<MEMO_COMMAND, 2> MEMOS({{
+    { "unstake",    MEMO_COMMAND::UNSTAKE },
+    { "voter pay",  MEMO_COMMAND::VOTER_PAY }
+}});
+
+// memos with arguments, e.g. |stake_cpu|receiver|epoch|
+static constexpr memo::memo_commands<MEMO_COMMAND, 1> MEMO_WORD_COMMANDS({{
+    { "stake_cpu",  MEMO_COMMAND::STAKE_CPU }
+}});
+
+static_assert( MEMOS.hashes_are_unique() && MEMO_WORD_COMMANDS.hashes_are_unique() );
@@ -27,6 +27,33 @@ ACTION cpucontract::initstate(){
 	state_s.set(s, _self);
 }
 
+/**
+ * Sets how long the same top21 vote can be kept before it is cast again
+ * 
+ * NOTE: If this has never been set, MAX_SECONDS_BETWEEN_VOTES is used.
+ * Votes are still only checked once every SECONDS_BETWEEN_VOTE_CHECKS.
+ * 
+ * Throws if the window is shorter than SECONDS_BETWEEN_VOTE_CHECKS
+ * 
+ * @param max_seconds_between_votes - the maximum age of a vote before it is refreshed
+ * 
+ * @required_auth - this contract
+ */
+
+ACTION cpucontract::setvotewindow(const uint64_t& max_seconds_between_votes){
+	require_auth( _self );
+	check( max_seconds_between_votes >= SECONDS_BETWEEN_VOTE_CHECKS, "window must be at least 1 day" );
+
+	state s = state_s.get();
+
+	// binary extensions are serialized in order, so last_vote_version has to exist first.
+	// dapp.fusion's top21 versions start at 1, so 0 still triggers a vote on the next check
+	if( !s.last_vote_version.has_value() ) s.last_vote_version.emplace(0);
+
+	s.max_seconds_between_votes.emplace(max_seconds_between_votes);
+	state_s.set(s, _self);
+}
+
 ACTION cpucontract::unstakebatch(const int& limit)
 {
 	require_auth( DAPP_CONTRACT );
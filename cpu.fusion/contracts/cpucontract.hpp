@@ -12,9 +12,12 @@
 #include <eosio/crypto.hpp>
 #include <eosio/transaction.hpp>
 #include <eosio/singleton.hpp>
+#include <eosio/binary_extension.hpp>
 #include <cmath>
 #include "tables.hpp"
+#include "../../include/memo.hpp"
 #include "constants.hpp"
+#include "../../include/lazy_check.hpp"
 #include <limits>
 
 using namespace eosio;
@@ -33,6 +36,7 @@ CONTRACT cpucontract : public contract {
 		ACTION claimgbmvote();
 		ACTION claimrefund();
 		ACTION initstate();
+		ACTION setvotewindow(const uint64_t& max_seconds_between_votes);
 		ACTION unstakebatch(const int& limit);
 
 		//Notifications
@@ -47,7 +51,7 @@ CONTRACT cpucontract : public contract {
 
 
 		//Functions
-		std::vector<std::string> get_words(std::string memo);
+		MEMO_COMMAND get_memo_command(std::string_view memo, const memo::memo_words& words);
 		uint64_t now();
 		void transfer_tokens(const name& user, const asset& amount_to_send, const name& contract, const std::string& memo);
 		void update_votes();
@@ -1,14 +1,10 @@
 #pragma once
 
-std::vector<std::string> cpucontract::get_words(std::string memo){
-  std::string delim = "|";
-  std::vector<std::string> words{};
-  size_t pos = 0;
-  while ((pos = memo.find(delim)) != std::string::npos) {
-    words.push_back(memo.substr(0, pos));
-    memo.erase(0, pos + delim.length());
-  }
-  return words;
+MEMO_COMMAND cpucontract::get_memo_command(std::string_view memo, const memo::memo_words& words){
+  const MEMO_COMMAND command = MEMOS.find( memo, MEMO_COMMAND::NONE );
+  if ( command != MEMO_COMMAND::NONE ) return command;
+
+  return MEMO_WORD_COMMANDS.find( words[1], MEMO_COMMAND::NONE );
 }
 
 uint64_t cpucontract::now(){
@@ -19,16 +15,27 @@ void cpucontract::transfer_tokens(const name& user, const asset& amount_to_send,
 	action(permission_level{get_self(), "active"_n}, contract,"transfer"_n,std::tuple{ get_self(), user, amount_to_send, memo}).send();
 }
 
+/**
+ * Votes for the producers in dapp.fusion's `top21`, but only if the list has
+ * changed since the last vote, or the last vote is older than state's max_seconds_between_votes
+ */
+
 void cpucontract::update_votes(){
 	state s = state_s.get();
 
-	if(s.last_vote_time + (60 * 60 * 24) <= now()){
-		top21 t = top21_s.get();
+	if(s.last_vote_time + SECONDS_BETWEEN_VOTE_CHECKS > now()) return;
+
+	top21 t = top21_s.get();
+	const uint64_t top21_version = t.version.value_or(0);
+	const uint64_t max_seconds_between_votes = s.max_seconds_between_votes.value_or(MAX_SECONDS_BETWEEN_VOTES);
+
+	const bool already_voted = s.last_vote_version.has_value() && s.last_vote_version.value() == top21_version;
+	if(already_voted && s.last_vote_time + max_seconds_between_votes > now()) return;
 
-		const eosio::name no_proxy;
-		action(permission_level{get_self(), "active"_n}, "eosio"_n,"voteproducer"_n,std::tuple{ get_self(), no_proxy, t.block_producers }).send();
+	const eosio::name no_proxy;
+	action(permission_level{get_self(), "active"_n}, "eosio"_n,"voteproducer"_n,std::tuple{ get_self(), no_proxy, t.block_producers }).send();
 
-		s.last_vote_time = now();
-		state_s.set(s, _self);
-	}
+	s.last_vote_time = now();
+	s.last_vote_version.emplace(top21_version);
+	state_s.set(s, _self);
 }
\ No newline at end of file
@@ -23,7 +23,10 @@ void cpucontract::receive_wax_transfer(const name& from, const name& to, const a
     //redundant check which isnt necessary when not using catchall notification handler
     check( tkcontract == WAX_CONTRACT, "first receiver should be eosio.token" );
 
-    if( memo == "voter pay" ){
+    const memo::memo_words  words   = memo::memo_words( memo );
+    const MEMO_COMMAND      command = get_memo_command( memo, words );
+
+    if( command == MEMO_COMMAND::VOTER_PAY ){
 
     	check( from == "eosio.voters"_n, "voter pay must come from eosio.voters" );
     	transfer_tokens( DAPP_CONTRACT, quantity, WAX_CONTRACT, std::string("waxfusion_revenue") );
@@ -32,7 +35,7 @@ void cpucontract::receive_wax_transfer(const name& from, const name& to, const a
     	return;
     }
 
-    if( memo == "unstake" ){
+    if( command == MEMO_COMMAND::UNSTAKE ){
 
     	check( from == "eosio.stake"_n, "unstakes should come from eosio.stake" );
     	transfer_tokens( DAPP_CONTRACT, quantity, WAX_CONTRACT, std::string("cpu rental return") );
@@ -40,14 +43,12 @@ void cpucontract::receive_wax_transfer(const name& from, const name& to, const a
     	return;    	
     }
 
-    std::vector<std::string> words = get_words(memo);
-
-    if( words[1] == "stake_cpu"){
+    if( command == MEMO_COMMAND::STAKE_CPU ){
 
-    	check( from == DAPP_CONTRACT, ("staking requests must come from " + DAPP_CONTRACT.to_string() ).c_str() );
+    	check( from == DAPP_CONTRACT, [&]{ return "staking requests must come from " + DAPP_CONTRACT.to_string(); } );
 
     	const eosio::name cpu_receiver = eosio::name( words[2] );
-    	const uint64_t epoch_timestamp = std::strtoull( words[3].c_str(), NULL, 0 );
+    	const uint64_t epoch_timestamp = memo::to_uint64( words[3] );
         
     	action(permission_level{get_self(), "active"_n}, "eosio"_n,"delegatebw"_n,std::tuple{ get_self(), cpu_receiver, asset(0, WAX_SYMBOL), quantity, false}).send();
 
@@ -19,17 +19,20 @@ typedef eosio::multi_index< "delband"_n, delegated_bandwidth > del_bandwidth_tab
 
 
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] state {
-  uint64_t          last_vote_time;
+  uint64_t                          last_vote_time;
+  eosio::binary_extension<uint64_t> last_vote_version;
+  eosio::binary_extension<uint64_t> max_seconds_between_votes;
 
-  EOSLIB_SERIALIZE(state, (last_vote_time))
+  EOSLIB_SERIALIZE(state, (last_vote_time)(last_vote_version)(max_seconds_between_votes))
 };
 using state_singleton = eosio::singleton<"state"_n, state>;
 
 
 struct [[eosio::table]] top21 {
-  std::vector<eosio::name>    block_producers;
-  uint64_t                    last_update;
+  std::vector<eosio::name>          block_producers;
+  uint64_t                          last_update;
+  eosio::binary_extension<uint64_t> version;
 
-  EOSLIB_SERIALIZE(top21, (block_producers)(last_update))
+  EOSLIB_SERIALIZE(top21, (block_producers)(last_update)(version))
 };
 using top21_singleton = eosio::singleton<"top21"_n, top21>;
\ No newline at end of file
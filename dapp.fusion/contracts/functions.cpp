@@ -32,17 +32,17 @@ int64_t fusion::calculate_asset_share(const int64_t& quantity, const uint64_t& p
  * Converts an sWAX amount into its lsWAX value
  * 
  * @param quantity - `int64_t` amount of sWAX to convert
- * @param g - global singleton
+ * @param s - state singleton
  * 
  * @return int64_t - calculated output amount of lsWAX
  */
 
-int64_t fusion::calculate_lswax_output(const int64_t& quantity, global& g) {
+int64_t fusion::calculate_lswax_output(const int64_t& quantity, state& s) {
 
-    if ( g.liquified_swax.amount == g.swax_currently_backing_lswax.amount ) {
+    if ( s.liquified_swax.amount == s.swax_currently_backing_lswax.amount ) {
         return quantity;
     } else {
-        return mulDiv( uint64_t(g.liquified_swax.amount), uint64_t(quantity), uint128_t(g.swax_currently_backing_lswax.amount) );
+        return mulDiv( uint64_t(s.liquified_swax.amount), uint64_t(quantity), uint128_t(s.swax_currently_backing_lswax.amount) );
     }
 
 }
@@ -51,16 +51,17 @@ int64_t fusion::calculate_lswax_output(const int64_t& quantity, global& g) {
  * Converts an lsWAX amount into its underlying sWAX value
  * 
  * @param quantity - `int64_t` amount of lsWAX to convert
- * @param g - global singleton
+ * @param s - state singleton
  * 
  * @return int64_t - calculated output amount of sWAX
  */
 
-int64_t fusion::calculate_swax_output(const int64_t& quantity, global& g) {
-    return mulDiv( uint64_t(g.swax_currently_backing_lswax.amount), uint64_t(quantity), uint128_t(g.liquified_swax.amount) );
+int64_t fusion::calculate_swax_output(const int64_t& quantity, state& s) {
+    return mulDiv( uint64_t(s.swax_currently_backing_lswax.amount), uint64_t(quantity), uint128_t(s.liquified_swax.amount) );
 }
 
 void fusion::create_alcor_farm(const uint64_t& poolId, const symbol& token_symbol, const name& token_contract, const uint32_t& duration) {
+  flush_token_ops();
   action(active_perm(), ALCOR_CONTRACT, "newincentive"_n,
          std::tuple{ _self, poolId, extended_asset(ZERO_LSWAX, TOKEN_CONTRACT), duration }
         ).send();
@@ -70,15 +71,15 @@ string fusion::cpu_stake_memo(const name& cpu_receiver, const uint64_t& epoch_ti
   return ("|stake_cpu|" + cpu_receiver.to_string() + "|" + std::to_string(epoch_timestamp) + "|").c_str();
 }
 
-void fusion::create_epoch(const global& g, const uint64_t& start_time, const name& cpu_wallet, const asset& wax_bucket) {
+void fusion::create_epoch(const state& s, const uint64_t& start_time, const name& cpu_wallet, const asset& wax_bucket) {
   epochs_t.emplace(_self, [&](auto & _e) {
     _e.start_time                       = start_time;
-    _e.time_to_unstake                  = start_time + g.cpu_rental_epoch_length_seconds - days_to_seconds(3);
+    _e.time_to_unstake                  = start_time + s.cpu_rental_epoch_length_seconds - days_to_seconds(3);
     _e.cpu_wallet                       = cpu_wallet;
     _e.wax_bucket                       = wax_bucket;
     _e.wax_to_refund                    = ZERO_WAX;
-    _e.redemption_period_start_time     = start_time + g.cpu_rental_epoch_length_seconds;
-    _e.redemption_period_end_time       = start_time + g.cpu_rental_epoch_length_seconds + days_to_seconds(2);
+    _e.redemption_period_start_time     = start_time + s.cpu_rental_epoch_length_seconds;
+    _e.redemption_period_end_time       = start_time + s.cpu_rental_epoch_length_seconds + days_to_seconds(2);
     _e.total_cpu_funds_returned         = ZERO_WAX;
     _e.total_added_to_redemption_bucket = ZERO_WAX;
   });
@@ -106,83 +107,172 @@ uint64_t fusion::days_to_seconds(const uint64_t& days) {
 
 void fusion::debit_user_redemptions_if_necessary(const name& user, const asset& swax_balance) {
 
-  global          g                                 = global_s.get();
-  requests_tbl    requests_t                        = requests_tbl(get_self(), user.value);
-  asset           total_amount_awaiting_redemption  = ZERO_WAX;
-  const uint64_t  first_epoch_to_check              = g.last_epoch_start_time - g.seconds_between_epochs;
+  user_requests requests = get_requests(user);
+  if ( requests.is_empty() ) return;
+
+  const state&    s                     = state_s.get();
+  const uint64_t  first_epoch_to_check  = s.last_epoch_start_time - s.seconds_between_epochs;
 
   // We only need to check the 3 active epochs
-  const std::vector<uint64_t> epochs_to_check = {
-    first_epoch_to_check + ( g.seconds_between_epochs * 2 ),
-    first_epoch_to_check + g.seconds_between_epochs,
+  const std::array<uint64_t, 3> epochs_to_check = {
+    first_epoch_to_check + ( s.seconds_between_epochs * 2 ),
+    first_epoch_to_check + s.seconds_between_epochs,
     first_epoch_to_check
   };
 
-  std::vector<uint64_t> pending_requests {};
+  // The slots can only add up to more than the epochs we find below, so if
+  // they already fit in the balance there's no need to look up any epochs
+  int64_t total_requested = 0;
 
   for (uint64_t ep : epochs_to_check) {
-    auto epoch_itr  = epochs_t.find(ep);
-    auto req_itr    = requests_t.find(ep);
+    const redemption_slot* slot = requests.find_slot(ep);
+    if ( slot != nullptr ) total_requested = safecast::add( total_requested, slot->wax_amount_requested );
+  }
 
-    if ( epoch_itr != epochs_t.end() && req_itr != requests_t.end() ) {
-        pending_requests.push_back(ep);
-        total_amount_awaiting_redemption += req_itr->wax_amount_requested;
-    }
+  if ( total_requested <= swax_balance.amount ) return;
+
+  // Keep the epoch iterators so they can be modified without looking them up again
+  struct pending_request {
+    redemption_slot*                slot;
+    epochs_table::const_iterator    epoch_itr;
+  };
+
+  std::array<pending_request, 3>  pending_requests;
+  size_t                          pending_count                     = 0;
+  int64_t                         total_amount_awaiting_redemption  = 0;
+
+  for (uint64_t ep : epochs_to_check) {
+    redemption_slot* slot = requests.find_slot(ep);
+    if ( slot == nullptr ) continue;
+
+    auto epoch_itr = epochs_t.find(ep);
+    if ( epoch_itr == epochs_t.end() ) continue;
+
+    pending_requests[ pending_count++ ]  = pending_request{ slot, epoch_itr };
+    total_amount_awaiting_redemption    = safecast::add( total_amount_awaiting_redemption, slot->wax_amount_requested );
   }
 
-  if( total_amount_awaiting_redemption.amount <= swax_balance.amount ) return;
+  if( total_amount_awaiting_redemption <= swax_balance.amount ) return;
 
-  int64_t amount_overdrawn = safecast::sub( total_amount_awaiting_redemption.amount, swax_balance.amount );
+  int64_t amount_overdrawn = safecast::sub( total_amount_awaiting_redemption, swax_balance.amount );
 
-  for (uint64_t& pending : pending_requests) {
-    auto epoch_itr  = epochs_t.require_find(pending, "error locating epoch");
-    auto req_itr    = requests_t.require_find(pending, "error locating redemption request");
+  for (size_t i = 0; i < pending_count; ++i) {
+    redemption_slot*    slot        = pending_requests[i].slot;
+    const auto&         epoch_itr   = pending_requests[i].epoch_itr;
 
-    if ( req_itr->wax_amount_requested.amount > amount_overdrawn ) {
-      requests_t.modify(req_itr, same_payer, [&](auto & _r) {
-        _r.wax_amount_requested.amount -= amount_overdrawn;
-      });
+    if ( slot->wax_amount_requested > amount_overdrawn ) {
+      slot->wax_amount_requested -= amount_overdrawn;
 
       epochs_t.modify(epoch_itr, _self, [&](auto & _e) {
         _e.wax_to_refund.amount -= amount_overdrawn;
       });
 
-      return;
+      break;
     }
 
-    else if ( req_itr->wax_amount_requested.amount == amount_overdrawn ) {
+    else if ( slot->wax_amount_requested == amount_overdrawn ) {
       epochs_t.modify(epoch_itr, _self, [&](auto & _e) {
         _e.wax_to_refund.amount -= amount_overdrawn;
       });
 
-      requests_t.erase( req_itr );
-      return;
+      *slot = redemption_slot{};
+      break;
     }
 
     else {
 
-      amount_overdrawn = safecast::sub( amount_overdrawn, req_itr->wax_amount_requested.amount );
+      amount_overdrawn = safecast::sub( amount_overdrawn, slot->wax_amount_requested );
 
       epochs_t.modify(epoch_itr, _self, [&](auto & _e) {
-        _e.wax_to_refund -= req_itr->wax_amount_requested;
+        _e.wax_to_refund.amount -= slot->wax_amount_requested;
       });
 
-      requests_t.erase( req_itr );
+      *slot = redemption_slot{};
     }
   }
+
+  save_requests( requests );
+}
+
+/**
+ * Checks if `migfarms` has moved every legacy `lpfarms`/`incentive_ids` row into `farms`
+ * 
+ * NOTE: Until it has, `farms` is incomplete, so anything that reads or writes
+ * it would skip (or duplicate) farms that only exist in the legacy tables.
+ * 
+ * @return bool - whether or not both legacy tables are empty
+ */
+
+bool fusion::farms_are_migrated() {
+  return lpfarms_t.begin() == lpfarms_t.end() && incent_ids_t.begin() == incent_ids_t.end();
+}
+
+/**
+ * Sends every queued `issue`/`retire` to `token.fusion` in a single `batch` action
+ * 
+ * NOTE: This has to be called before any other inline action is sent, so that
+ * the batch still runs in the same position the individual `issue`/`retire`
+ * actions used to. The destructor only flushes whatever is queued last.
+ */
+
+void fusion::flush_token_ops() {
+  if ( token_ops.empty() ) return;
+
+  action(active_perm(), TOKEN_CONTRACT, "batch"_n, std::tuple{ token_ops }).send();
+  token_ops.clear();
+}
+
+/**
+ * Finds the `rentals` row for a renter/receiver combo
+ * 
+ * NOTE: Rows are keyed by `rental_key`. If that key is already taken by
+ * a different combo, the next key is checked until we find either the
+ * combo or an unused key. Rows are only ever erased all at once by 
+ * `unstakecpu`, so there are never any gaps to probe past.
+ * 
+ * @param rentals_t - the `rentals` table for the epoch
+ * @param renter - the wallet that paid for the rental
+ * @param receiver - the wallet receiving the CPU
+ * @param free_key - set to the key a new row should use if the combo isn't found
+ * 
+ * @return iterator to the row, or `rentals_t.end()` if there isn't one
+ */
+
+rentals_table::const_iterator fusion::find_rental(rentals_table& rentals_t, const name& renter, const name& receiver, uint64_t& free_key) {
+
+  uint64_t  key = rental_key( renter, receiver );
+  auto      itr = rentals_t.find( key );
+
+  while ( itr != rentals_t.end() ) {
+    if ( itr->renter == renter && itr->rent_to_account == receiver ) return itr;
+    key ++;
+    itr = rentals_t.find( key );
+  }
+
+  free_key = key;
+  return itr;
 }
 
-eosio::name fusion::get_next_cpu_contract(global& g) {
+/**
+ * Finds the position of `current_cpu_contract` in the `cpu_contracts` rotation
+ * 
+ * @param s - `state` singleton
+ * @param c - `config` singleton
+ * 
+ * @return size_t - index of the current cpu contract in `c.cpu_contracts`
+ */
 
-  auto itr = std::find( g.cpu_contracts.begin(), g.cpu_contracts.end(), g.current_cpu_contract );
-  check( itr != g.cpu_contracts.end(), "error locating cpu contract" );
+size_t fusion::get_cpu_contract_index(const state& s, const config& c) {
 
-  auto next_cpu_index     = ( std::distance(g.cpu_contracts.begin(), itr) + 1 ) % g.cpu_contracts.size();
-  name next_cpu_contract  = g.cpu_contracts[next_cpu_index];
+  auto itr = std::find( c.cpu_contracts.begin(), c.cpu_contracts.end(), s.current_cpu_contract );
+  check( itr != c.cpu_contracts.end(), "error locating cpu contract" );
+  check( c.cpu_contracts.size() > 1, "next cpu contract cant be the same as the current contract" );
 
-  check(next_cpu_contract != g.current_cpu_contract, "next cpu contract cant be the same as the current contract");
+  return size_t( std::distance(c.cpu_contracts.begin(), itr) );
+}
 
-  return next_cpu_contract;
+eosio::name fusion::get_next_cpu_contract(const state& s, const config& c) {
+  return c.cpu_contracts[ ( get_cpu_contract_index( s, c ) + 1 ) % c.cpu_contracts.size() ];
 }
 
 /**
@@ -193,26 +283,26 @@ eosio::name fusion::get_next_cpu_contract(global& g) {
  * they want to rent from, and then we dynamically calculate the price
  * (based on time remaining in that epoch).
  * 
- * @param g - `global` singleton
+ * @param s - `state` singleton
  * @param epoch_id_to_rent_from - which epoch the renter wants to rent from
  * 
  * @return uint64_t - amount of seconds remaining in the epoch
  */
 
-uint64_t fusion::get_seconds_to_rent_cpu( global& g, const uint64_t& epoch_id_to_rent_from ) {
+uint64_t fusion::get_seconds_to_rent_cpu( state& s, const uint64_t& epoch_id_to_rent_from ) {
   
-  uint64_t seconds_into_current_epoch = now() - g.last_epoch_start_time;
+  uint64_t seconds_into_current_epoch = now() - s.last_epoch_start_time;
   uint64_t seconds_to_rent;
 
-  if ( epoch_id_to_rent_from == g.last_epoch_start_time + g.seconds_between_epochs ) {
+  if ( epoch_id_to_rent_from == s.last_epoch_start_time + s.seconds_between_epochs ) {
     // Renting from epoch 3 (hasnt started yet)
     seconds_to_rent = days_to_seconds(18) - seconds_into_current_epoch;
 
-  } else if ( epoch_id_to_rent_from == g.last_epoch_start_time ) {
+  } else if ( epoch_id_to_rent_from == s.last_epoch_start_time ) {
     // Renting from epoch 2 (started most recently)
     seconds_to_rent = days_to_seconds(11) - seconds_into_current_epoch;
 
-  } else if ( epoch_id_to_rent_from == g.last_epoch_start_time - g.seconds_between_epochs ) {
+  } else if ( epoch_id_to_rent_from == s.last_epoch_start_time - s.seconds_between_epochs ) {
     // Renting from epoch 1 (oldest) and we need to make sure it's less than 11 days old
     check( seconds_into_current_epoch < days_to_seconds(4), "it is too late to rent from this epoch, please rent from the next one" );
 
@@ -227,44 +317,65 @@ uint64_t fusion::get_seconds_to_rent_cpu( global& g, const uint64_t& epoch_id_to
 }
 
 
-vector<string> fusion::get_words(string memo) {
-  string delim = "|";
-  vector<string> words{};
-  size_t pos = 0;
-  while ((pos = memo.find(delim)) != string::npos) {
-    words.push_back(memo.substr(0, pos));
-    memo.erase(0, pos + delim.length());
-  }
-  return words;
+/**
+ * Looks up which operation an LSWAX transfer memo is for
+ * 
+ * @param memo - the memo that was sent with the transfer
+ * @param words - the same memo, split with `memo::memo_words`
+ * 
+ * @return MEMO_COMMAND - `NONE` if the memo isn't one we expect with LSWAX
+ */
+
+MEMO_COMMAND fusion::get_lswax_memo_command(std::string_view memo, const memo::memo_words& words) {
+  const MEMO_COMMAND command = LSWAX_MEMOS.find( memo, MEMO_COMMAND::NONE );
+  if ( command != MEMO_COMMAND::NONE ) return command;
+
+  return LSWAX_MEMO_WORD_COMMANDS.find( words[1], MEMO_COMMAND::NONE );
 }
 
 /**
- * Checks if `user` is one of the `admin_wallets` in `global` singleton
+ * Looks up which operation a WAX transfer memo is for
+ * 
+ * @param memo - the memo that was sent with the transfer
+ * @param words - the same memo, split with `memo::memo_words`
+ * 
+ * @return MEMO_COMMAND - `NONE` if the memo isn't one we expect with WAX
+ */
+
+MEMO_COMMAND fusion::get_wax_memo_command(std::string_view memo, const memo::memo_words& words) {
+  const MEMO_COMMAND command = WAX_MEMOS.find( memo, MEMO_COMMAND::NONE );
+  if ( command != MEMO_COMMAND::NONE ) return command;
+
+  return WAX_MEMO_WORD_COMMANDS.find( words[1], MEMO_COMMAND::NONE );
+}
+
+/**
+ * Checks if `user` is one of the `admin_wallets` in `config` singleton
  * 
  * NOTE: While this contract is under multisig, there are some less critical
  * actions that can be called by accounts that we've given elevated permissions to.
  * 
- * @param g - `global` singleton
+ * @param c - `config` singleton
  * @param user - the wallet address to look for in the `admin_wallets` vector
  * 
  * @return bool - whether or not the address was found
  */
 
-bool fusion::is_an_admin(global& g, const name& user) {
-  return std::find(g.admin_wallets.begin(), g.admin_wallets.end(), user) != g.admin_wallets.end();
+bool fusion::is_an_admin(const config& c, const name& user) {
+  return std::find(c.admin_wallets.begin(), c.admin_wallets.end(), user) != c.admin_wallets.end();
 }
 
 /**
- * Checks if `contract` is one of the `cpu_contracts` in `global` singleton
+ * Checks if `contract` is one of the `cpu_contracts` in `config` singleton
  * 
- * @param g - `global` singleton
+ * @param c - `config` singleton
  * @param contract - the wallet address to look for in the `cpu_contracts` vector
  * 
  * @return bool - whether or not the address was found
  */
 
-bool fusion::is_cpu_contract(global& g, const name& contract) {
-  return std::find( g.cpu_contracts.begin(), g.cpu_contracts.end(), contract) != g.cpu_contracts.end();
+bool fusion::is_cpu_contract(const config& c, const name& contract) {
+  return std::find( c.cpu_contracts.begin(), c.cpu_contracts.end(), contract) != c.cpu_contracts.end();
 }
 
 bool fusion::is_lswax_or_wax(const symbol& symbol, const name& contract)
@@ -273,60 +384,155 @@ bool fusion::is_lswax_or_wax(const symbol& symbol, const name& contract)
 }
 
 void fusion::issue_lswax(const int64_t& amount, const name& receiver) {
-  action(active_perm(), TOKEN_CONTRACT, "issue"_n, std::tuple{ _self, receiver, asset(amount, LSWAX_SYMBOL), std::string("issuing lsWAX to liquify") }).send();
+  queue_token_op( "issue"_n, receiver, asset(amount, LSWAX_SYMBOL), "issuing lsWAX to liquify" );
 }
 
 void fusion::issue_swax(const int64_t& amount) {
-  action(active_perm(), TOKEN_CONTRACT, "issue"_n, std::tuple{ _self, _self, asset(amount, SWAX_SYMBOL), std::string("issuing sWAX for staking") }).send();
+  queue_token_op( "issue"_n, _self, asset(amount, SWAX_SYMBOL), "issuing sWAX for staking" );
 }
 
-bool fusion::memo_is_expected(const string& memo) {
+inline uint64_t fusion::now() {
+  return current_time_point().sec_since_epoch();
+}
 
-  if ( memo == "instant redeem" || memo == "rebalance" || memo == "wax_lswax_liquidity" || memo == "stake" || memo == "unliquify" || memo == "waxfusion_revenue" || memo == "cpu rental return" || memo == "lp_incentives" ) {
-    return true;
-  }
+/**
+ * Queues an `issue`/`retire` operation for `token.fusion`
+ * 
+ * NOTE: Consecutive operations of the same kind, for the same token, receiver
+ * and memo, are merged into one. Only the last queued operation is merged
+ * into, so the relative order of issues and retires is preserved.
+ * 
+ * @param op - `issue` or `retire`
+ * @param to - the receiver of an `issue`, `_self` for `retire`
+ * @param quantity - the amount to issue or retire
+ * @param memo - the memo the standalone `issue`/`retire` action would have used
+ */
+
+void fusion::queue_token_op(const name& op, const name& to, const asset& quantity, const string& memo) {
+  if ( !token_ops.empty() ) {
+    token_op& last = token_ops.back();
 
-  string          memo_copy   = memo;
-  vector<string>  words       = get_words(memo_copy);
+    if ( last.op == op && last.to == to && last.quantity.symbol == quantity.symbol && last.memo == memo ) {
+      last.quantity.amount = safecast::add( last.quantity.amount, quantity.amount );
+      return;
+    }
+  }
 
-  return ( words[1] == "rent_cpu" || words[1] == "unliquify_exact" || words[1] == "new_incentive" );
+  token_ops.push_back( token_op{ op, to, quantity, memo } );
 }
 
-inline uint64_t fusion::now() {
-  return current_time_point().sec_since_epoch();
+/**
+ * Fails a transfer whose memo isn't accepted with the token that was sent
+ * 
+ * NOTE: This only runs once the memo didn't match anything for the token
+ * that was sent, so the lookup for the other token stays off the normal path.
+ * Transfers from eosio with unexpected memos are allowed during testing.
+ * 
+ * @param from - the sender of the transfer
+ * @param other_token_command - the memo looked up for the other token
+ */
+
+void fusion::reject_memo(const name& from, const MEMO_COMMAND& other_token_command) {
+  switch ( other_token_command ) {
+    case MEMO_COMMAND::NONE:
+      check( from == "eosio"_n, "must include a memo for transfers to dapp.fusion, see docs.waxfusion.io for a list of memos" );
+      return;
+    case MEMO_COMMAND::INSTANT_REDEEM:
+    case MEMO_COMMAND::REBALANCE:
+      check( false, "only LSWAX should be sent with this memo" );
+    case MEMO_COMMAND::NEW_INCENTIVE:
+      check( false, "only LSWAX can be sent with this memo" );
+    case MEMO_COMMAND::UNLIQUIFY:
+    case MEMO_COMMAND::UNLIQUIFY_EXACT:
+      check( false, "only LSWAX can be unliquified" );
+    case MEMO_COMMAND::WAX_LSWAX_LIQUIDITY:
+      check( false, "only WAX should be sent with this memo" );
+    case MEMO_COMMAND::STAKE:
+      check( false, "only WAX is used for staking" );
+    case MEMO_COMMAND::WAXFUSION_REVENUE:
+      check( false, "only WAX is accepted with waxfusion_revenue memo" );
+    case MEMO_COMMAND::CPU_RENTAL_RETURN:
+    case MEMO_COMMAND::RENT_CPU:
+    default:
+      check( false, "only WAX can be sent with this memo" );
+  }
 }
 
 void fusion::retire_lswax(const int64_t& amount) {
-  action(active_perm(), TOKEN_CONTRACT, "retire"_n, std::tuple{ asset(amount, LSWAX_SYMBOL), std::string("retiring lsWAX to unliquify")}).send();
+  queue_token_op( "retire"_n, _self, asset(amount, LSWAX_SYMBOL), "retiring lsWAX to unliquify" );
+}
+
+/**
+ * Hashes a renter/receiver combo into a 64 bit key for the `rentals` table
+ * 
+ * NOTE: Uses the splitmix64 finalizer so that similar names don't end up
+ * next to each other. Collisions are handled by `find_rental`.
+ */
+
+uint64_t fusion::rental_key(const name& renter, const name& receiver) {
+  uint64_t key = renter.value ^ ( receiver.value * 0x9E3779B97F4A7C15ULL );
+  key = ( key ^ ( key >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+  key = ( key ^ ( key >> 27 ) ) * 0x94D049BB133111EBULL;
+  return key ^ ( key >> 31 );
 }
 
 void fusion::retire_swax(const int64_t& amount) {
-  action(active_perm(), TOKEN_CONTRACT, "retire"_n, std::tuple{ asset(amount, SWAX_SYMBOL), std::string("retiring sWAX for redemption")}).send();
+  queue_token_op( "retire"_n, _self, asset(amount, SWAX_SYMBOL), "retiring sWAX for redemption" );
 }
 
-inline void fusion::sync_epoch(global& g) {
+/**
+ * Checks that there are enough producers to vote for, and sorts them by name
+ * 
+ * NOTE: Comparing `name` values gives the same order as comparing the strings,
+ * since each character is encoded in ascending order ('.' < '1'-'5' < 'a'-'z')
+ * starting from the most significant bits, and valid names can't end with '.'
+ * 
+ * @param producers - the producers that were collected
+ * @param count - how many of `producers` are filled in
+ * 
+ * @return vector<name> - the producers to vote for
+ */
 
-  uint64_t next_epoch_start_time = g.last_epoch_start_time + g.seconds_between_epochs;
+vector<name> fusion::sort_top21(top21_names& producers, const size_t& count) {
+  check( count >= MINIMUM_PRODUCERS_TO_VOTE_FOR, [&]{ return "attempting to vote for " + std::to_string( count ) + " producers but need to vote for " + std::to_string( MINIMUM_PRODUCERS_TO_VOTE_FOR ); } );
 
-  // There is an edge case possible where if the contract has no interactions over the course
-  // of an entire epoch, then the epoch would never get created. This is solved by
-  // using a while loop to create any missing epochs if they got skipped
-  while ( now() >= next_epoch_start_time ) {
+  std::sort( producers.begin(), producers.begin() + count );
+  return vector<name>( producers.begin(), producers.begin() + count );
+}
 
-    name next_cpu_contract = get_next_cpu_contract( g );
+inline void fusion::sync_epoch(state& s) {
 
-    g.last_epoch_start_time = next_epoch_start_time;
-    g.current_cpu_contract  = next_cpu_contract;
+  uint64_t next_epoch_start_time = s.last_epoch_start_time + s.seconds_between_epochs;
 
-    if ( epochs_t.find(next_epoch_start_time) == epochs_t.end() ) {
-      create_epoch( g, next_epoch_start_time, next_cpu_contract, ZERO_WAX );
-    }
+  if ( now() < next_epoch_start_time ) return;
 
-    next_epoch_start_time += g.seconds_between_epochs;
+  // The cpu contract rotation is the only thing we need from `config`,
+  // so it only gets loaded when an epoch boundary has been crossed
+  const config& c = config_s.get();
+
+  // If the contract has no interactions over the course of an entire epoch, that
+  // epoch never gets created. Any number of missed epochs is caught up in one step,
+  // and only the ones that can still be rented from or returned to are created
+  const uint64_t  epochs_elapsed      = ( now() - s.last_epoch_start_time ) / s.seconds_between_epochs;
+  const uint64_t  epochs_in_use       = s.cpu_rental_epoch_length_seconds / s.seconds_between_epochs + 1;
+  const size_t    cpu_index           = get_cpu_contract_index( s, c );
+  const size_t    cpu_contract_count  = c.cpu_contracts.size();
+
+  for ( uint64_t i = epochs_elapsed - std::min( epochs_elapsed, epochs_in_use ) + 1; i <= epochs_elapsed; i++ ) {
+    const uint64_t start_time = s.last_epoch_start_time + s.seconds_between_epochs * i;
+
+    if ( epochs_t.find(start_time) == epochs_t.end() ) {
+      create_epoch( s, start_time, c.cpu_contracts[ ( cpu_index + i ) % cpu_contract_count ], ZERO_WAX );
+    }
   }
+
+  s.last_epoch_start_time += s.seconds_between_epochs * epochs_elapsed;
+  s.current_cpu_contract  =  c.cpu_contracts[ ( cpu_index + epochs_elapsed ) % cpu_contract_count ];
 }
 
 void fusion::transfer_tokens(const name& user, const asset& amount_to_send, const name& contract, const string& memo) {
+  flush_token_ops();
+
   action(active_perm(), contract, "transfer"_n, std::tuple{ get_self(), user, amount_to_send, memo}).send();
 }
 
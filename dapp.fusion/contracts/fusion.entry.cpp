@@ -9,7 +9,7 @@
 //contractName: fusion
 
 /** 
- * Adds a new admin wallet to the `global` singleton
+ * Adds a new admin wallet to the `config` singleton
  * 
  * @param admin_to_add - the wallet address of the new admin
  * 
@@ -20,16 +20,15 @@ ACTION fusion::addadmin(const name& admin_to_add) {
     require_auth(_self);
     check( is_account(admin_to_add), "admin_to_add is not a wax account" );
 
-    global g = global_s.get();
+    config& c = config_s.modify();
 
-    check( std::find( g.admin_wallets.begin(), g.admin_wallets.end(), admin_to_add ) == g.admin_wallets.end(), ( admin_to_add.to_string() + " is already an admin" ).c_str() );
+    check( std::find( c.admin_wallets.begin(), c.admin_wallets.end(), admin_to_add ) == c.admin_wallets.end(), [&]{ return admin_to_add.to_string() + " is already an admin"; } );
     
-    g.admin_wallets.push_back( admin_to_add );
-    global_s.set(g, _self);
+    c.admin_wallets.push_back( admin_to_add );
 }
 
 /** 
- * Adds a new cpu contract to the `global` singleton
+ * Adds a new cpu contract to the `config` singleton
  * 
  * @param contract_to_add - the wallet address of the new cpu contract
  * 
@@ -40,11 +39,10 @@ ACTION fusion::addcpucntrct(const name& contract_to_add) {
     require_auth(_self);
     check( is_account(contract_to_add), "contract_to_add is not a wax account" );
 
-    global g = global_s.get();
+    config& c = config_s.modify();
 
-    check( std::find( g.cpu_contracts.begin(), g.cpu_contracts.end(), contract_to_add ) == g.cpu_contracts.end(), ( contract_to_add.to_string() + " is already a cpu contract" ).c_str() );
-    g.cpu_contracts.push_back( contract_to_add );
-    global_s.set(g, _self);
+    check( std::find( c.cpu_contracts.begin(), c.cpu_contracts.end(), contract_to_add ) == c.cpu_contracts.end(), [&]{ return contract_to_add.to_string() + " is already a cpu contract"; } );
+    c.cpu_contracts.push_back( contract_to_add );
 }
 
 /** 
@@ -65,40 +63,38 @@ ACTION fusion::claimaslswax(const name& user, const asset& minimum_output) {
 
     require_auth(user);
 
-    global  g = global_s.get();
-    rewards r = rewards_s.get();
+    state&  s = state_s.modify();
+    rewards& r = rewards_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);  
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     check( minimum_output > ZERO_LSWAX, "Invalid output quantity." );
     check( minimum_output.amount < MAX_ASSET_AMOUNT, "output quantity too large" );
     check( staker.claimable_wax > ZERO_WAX, "you have no wax to claim" );
 
     int64_t claimable_wax_amount    = staker.claimable_wax.amount;
-    int64_t converted_lsWAX_i64     = calculate_lswax_output( claimable_wax_amount, g );
-    check( converted_lsWAX_i64 >= minimum_output.amount, "output would be " + asset(converted_lsWAX_i64, LSWAX_SYMBOL).to_string() + " but expected " + minimum_output.to_string() );
+    int64_t converted_lsWAX_i64     = calculate_lswax_output( claimable_wax_amount, s );
+    check( converted_lsWAX_i64 >= minimum_output.amount, [&]{ return "output would be " + asset(converted_lsWAX_i64, LSWAX_SYMBOL).to_string() + " but expected " + minimum_output.to_string(); } );
 
     staker.claimable_wax        =   ZERO_WAX;
     self_staker.swax_balance    +=  asset(claimable_wax_amount, SWAX_SYMBOL);
 
-    modify_staker(staker);
-    modify_staker(self_staker);
+    staker.save();
+    self_staker.save();
 
     r.totalSupply += uint128_t(claimable_wax_amount);
 
-    g.liquified_swax                += asset(converted_lsWAX_i64, LSWAX_SYMBOL);
-    g.swax_currently_backing_lswax  += asset(claimable_wax_amount, SWAX_SYMBOL);
-    g.wax_available_for_rentals     += asset(claimable_wax_amount, WAX_SYMBOL);
-    g.total_rewards_claimed         += asset(claimable_wax_amount, WAX_SYMBOL);
-
-    rewards_s.set(r, _self);    
-    global_s.set(g, _self);
+    s.liquified_swax                += asset(converted_lsWAX_i64, LSWAX_SYMBOL);
+    s.swax_currently_backing_lswax  += asset(claimable_wax_amount, SWAX_SYMBOL);
+    s.wax_available_for_rentals     += asset(claimable_wax_amount, WAX_SYMBOL);
+    s.total_rewards_claimed         += asset(claimable_wax_amount, WAX_SYMBOL);
 
     issue_swax(claimable_wax_amount);
     issue_lswax(converted_lsWAX_i64, user);
@@ -117,8 +113,9 @@ ACTION fusion::claimaslswax(const name& user, const asset& minimum_output) {
 
 ACTION fusion::claimgbmvote(const name& cpu_contract)
 {
-    global g = global_s.get();
-    check( is_cpu_contract(g, cpu_contract), ( cpu_contract.to_string() + " is not a cpu rental contract").c_str() );
+    const config& c = config_s.get();
+    check( is_cpu_contract(c, cpu_contract), [&]{ return cpu_contract.to_string() + " is not a cpu rental contract"; } );
+    flush_token_ops();
     action(active_perm(), cpu_contract, "claimgbmvote"_n, std::tuple{}).send();
 }
 
@@ -135,14 +132,15 @@ ACTION fusion::claimgbmvote(const name& cpu_contract)
 
 ACTION fusion::claimrefunds()
 {
-    global  g                   = global_s.get();
-    bool    refund_is_available = false;
+    const config&   c                   = config_s.get();
+    bool            refund_is_available = false;
 
-    for (name ctrct : g.cpu_contracts) {
+    for (name ctrct : c.cpu_contracts) {
         refunds_table   refunds_t   = refunds_table( SYSTEM_CONTRACT, ctrct.value );
         auto            refund_itr  = refunds_t.find( ctrct.value );
 
         if ( refund_itr != refunds_t.end() && refund_itr->request_time + seconds(REFUND_DELAY_SEC) <= current_time_point() ) {
+            flush_token_ops();
             action(active_perm(), ctrct, "claimrefund"_n, std::tuple{}).send();
             refund_is_available = true;
         }
@@ -164,29 +162,27 @@ ACTION fusion::claimrewards(const name& user) {
 
     require_auth(user);
 
-    global  g = global_s.get();
-    rewards r = rewards_s.get();
+    state&  s = state_s.modify();
+    rewards& r = rewards_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     check( staker.claimable_wax > ZERO_WAX, "you have no wax to claim" );
 
     asset claimable_wax     = staker.claimable_wax;
     staker.claimable_wax    = ZERO_WAX;
 
-    modify_staker(staker);
-    modify_staker(self_staker); 
+    staker.save();
+    self_staker.save(); 
 
-    g.total_rewards_claimed += claimable_wax;   
-
-    global_s.set(g, _self);
-    rewards_s.set(r, _self);
+    s.total_rewards_claimed += claimable_wax;   
 
     transfer_tokens( user, claimable_wax, WAX_CONTRACT, std::string("your sWAX reward claim from waxfusion.io - liquid staking protocol") );
 }
@@ -206,16 +202,17 @@ ACTION fusion::claimswax(const name& user) {
 
     require_auth(user);
 
-    global  g = global_s.get();
-    rewards r = rewards_s.get();
+    state&  s = state_s.modify();
+    rewards& r = rewards_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     check( staker.claimable_wax > ZERO_WAX, "you have no wax to claim" );
     int64_t swax_amount_to_claim = staker.claimable_wax.amount;
@@ -225,15 +222,12 @@ ACTION fusion::claimswax(const name& user) {
     staker.claimable_wax    =   ZERO_WAX;
     staker.swax_balance     +=  asset(swax_amount_to_claim, SWAX_SYMBOL);
 
-    modify_staker(staker);
-    modify_staker(self_staker);
+    staker.save();
+    self_staker.save();
 
-    g.swax_currently_earning.amount     += swax_amount_to_claim;
-    g.wax_available_for_rentals.amount  += swax_amount_to_claim;
-    g.total_rewards_claimed.amount      += swax_amount_to_claim;
-
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
+    s.swax_currently_earning.amount     += swax_amount_to_claim;
+    s.wax_available_for_rentals.amount  += swax_amount_to_claim;
+    s.total_rewards_claimed.amount      += swax_amount_to_claim;
 
     issue_swax(swax_amount_to_claim);
 }
@@ -241,6 +235,13 @@ ACTION fusion::claimswax(const name& user) {
 /**
  * Allows a `user` to erase expired redemption requests.
  * 
+ * NOTE: If that leaves the user's `userrequests` row with no requests
+ * (or it had none to begin with), the row is erased so the RAM is freed.
+ * Legacy `rdmrequests` rows are migrated by `get_requests` first, which
+ * erases the expired ones.
+ * 
+ * Throws if the user has neither a `userrequests` row nor legacy requests
+ * 
  * @param user - wallet address of the user who is erasing requests
  * 
  * @required_auth - user
@@ -249,23 +250,34 @@ ACTION fusion::claimswax(const name& user) {
 ACTION fusion::clearexpired(const name& user) {
     require_auth(user);
 
-    global g = global_s.get();
+    state&  s = state_s.modify();
+
+    sync_epoch( s );
 
-    sync_epoch( g );
+    requests_tbl    legacy_t    = requests_tbl(get_self(), user.value);
+    const bool      has_row     = requests_t.find( user.value ) != requests_t.end();
 
-    requests_tbl requests_t = requests_tbl(get_self(), user.value);
-    check( requests_t.begin() != requests_t.end(), "there are no requests to clear" );
+    check( has_row || legacy_t.begin() != legacy_t.end(), "there are no requests to clear" );
 
-    uint64_t    upper_bound = g.last_epoch_start_time - g.seconds_between_epochs - 1;
-    auto        itr         = requests_t.begin();
+    user_requests requests = get_requests(user);
 
-    while (itr != requests_t.end()) {
-        if (itr->epoch_id >= upper_bound) break;
+    uint64_t upper_bound = s.last_epoch_start_time - s.seconds_between_epochs - 1;
 
-        itr = requests_t.erase(itr);
+    for (redemption_slot& slot : requests.slots) {
+        if (slot.epoch_id != 0 && slot.epoch_id < upper_bound) slot = redemption_slot{};
+    }
+
+    if ( requests.is_empty() ) {
+        // `get_requests` only creates a row if a legacy request was still live
+        auto itr = requests_t.find( user.value );
+        if ( itr != requests_t.end() ) {
+            update_epoch_requests( *itr, requests );
+            requests_t.erase( itr );
+        }
+    } else {
+        save_requests( requests );
     }
 
-    global_s.set(g, _self);
 }
 
 /**
@@ -280,37 +292,35 @@ ACTION fusion::clearexpired(const name& user) {
 
 ACTION fusion::compound(){
 
-    global  g = global_s.get();
-    rewards r = rewards_s.get();
+    state&  s = state_s.modify();
+    rewards& r = rewards_s.modify();
 
-    check( g.last_compound_time + (5*60) <= now(), "must wait 5 minutes between compounds" );
+    check( s.last_compound_time + (5*60) <= now(), "must wait 5 minutes between compounds" );
 
-    sync_epoch( g );    
+    sync_epoch( s );    
 
-    auto            self_staker_itr = staker_t.require_find( _self.value, ERR_STAKER_NOT_FOUND );
-    staker_struct   self_staker     = staker_struct(*self_staker_itr);    
+    staker_handle   self_staker     = get_staker(_self);    
 
-    extend_reward(g, r, self_staker);
-    update_reward(self_staker, r);  
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(self_staker, r);
 
     int64_t amount_to_compound = self_staker.claimable_wax.amount;
     check( amount_to_compound > 0, "nothing to compound" ); 
     
     self_staker.swax_balance.amount +=  amount_to_compound;
     self_staker.claimable_wax       =   ZERO_WAX;
-    modify_staker(self_staker);     
+    self_staker.save();     
 
     r.totalSupply += uint128_t(amount_to_compound);
 
-    g.swax_currently_backing_lswax.amount   +=  amount_to_compound;
-    g.total_rewards_claimed.amount          +=  amount_to_compound;
-    g.wax_available_for_rentals.amount      +=  amount_to_compound;
-    g.last_compound_time                    =   now();
+    s.swax_currently_backing_lswax.amount   +=  amount_to_compound;
+    s.total_rewards_claimed.amount          +=  amount_to_compound;
+    s.wax_available_for_rentals.amount      +=  amount_to_compound;
+    s.last_compound_time                    =   now();
 
     issue_swax( amount_to_compound );
 
-    rewards_s.set(r, _self);
-    global_s.set(g, _self); 
 
 }
 
@@ -318,12 +328,13 @@ ACTION fusion::compound(){
 
 ACTION fusion::createfarms() {
 
-    global g = global_s.get();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
-    check( g.last_incentive_distribution + LP_FARM_DURATION_SECONDS <= now(), "hasn't been 1 week since last farms were created");
-    check( g.incentives_bucket > ZERO_LSWAX, "no lswax in the incentives_bucket" );
+    check( s.last_incentive_distribution + LP_FARM_DURATION_SECONDS <= now(), "hasn't been 1 week since last farms were created");
+    check( s.incentives_bucket > ZERO_LSWAX, "no lswax in the incentives_bucket" );
+    check( farms_are_migrated(), "run migfarms first" );
 
     // we have to know what the ID of each incentive will be on alcor's contract before submitting
     // the transaction. we can do this by fetching the last row from alcor's incentives table,
@@ -337,34 +348,32 @@ ACTION fusion::createfarms() {
         next_key = it->id + 1;
     }
 
-    for (auto lp_itr = lpfarms_t.begin(); lp_itr != lpfarms_t.end(); lp_itr++) {
+    for (auto farm_itr = farms_t.begin(); farm_itr != farms_t.end(); farm_itr++) {
 
-        int64_t         lswax_allocation_i64    = calculate_asset_share( g.incentives_bucket.amount, lp_itr->percent_share_1e6 );
-        auto            incent_itr              = incent_ids_t.find( lp_itr->poolId );
+        int64_t         lswax_allocation_i64    = calculate_asset_share( s.incentives_bucket.amount, farm_itr->percent_share_1e6 );
         std::string     memo;
 
         total_lswax_allocated = safecast::add( total_lswax_allocated, lswax_allocation_i64 );
 
-        if( incent_itr == incent_ids_t.end() ){
-            create_alcor_farm( lp_itr->poolId, lp_itr->symbol_to_incentivize, lp_itr->contract_to_incentivize, safecast::safe_cast<uint32_t>(LP_FARM_DURATION_SECONDS) );
+        if( !farm_itr->incentive_id.has_value() ){
+            create_alcor_farm( farm_itr->poolId, farm_itr->symbol_to_incentivize, farm_itr->contract_to_incentivize, safecast::safe_cast<uint32_t>(LP_FARM_DURATION_SECONDS) );
 
-            incent_ids_t.emplace(_self, [&](auto &_incent){
-                _incent.pool_id         = lp_itr->poolId;
-                _incent.incentive_id    = next_key;
+            farms_t.modify(farm_itr, _self, [&](auto & _farm) {
+                _farm.incentive_id = next_key;
             });
 
             memo = "incentreward#" + std::to_string( next_key );
             next_key ++;
         } else {
-            if(incent_itr->pending_boosts > ZERO_LSWAX){
-                lswax_allocation_i64 = safecast::add( incent_itr->pending_boosts.amount, lswax_allocation_i64 );
+            if(farm_itr->pending_boosts > ZERO_LSWAX){
+                lswax_allocation_i64 = safecast::add( farm_itr->pending_boosts.amount, lswax_allocation_i64 );
 
-                incent_ids_t.modify(incent_itr, _self, [&](auto & _incent) {
-                    _incent.pending_boosts = ZERO_LSWAX;
+                farms_t.modify(farm_itr, _self, [&](auto & _farm) {
+                    _farm.pending_boosts = ZERO_LSWAX;
                 });                
             }
 
-            memo = "incentreward#" + std::to_string( incent_itr->incentive_id );
+            memo = "incentreward#" + std::to_string( *farm_itr->incentive_id );
         }
 
         // Only the incentive creator can deposit rewards to an Alcor farm,
@@ -373,18 +382,17 @@ ACTION fusion::createfarms() {
         transfer_tokens( ALCOR_CONTRACT, asset(lswax_allocation_i64, LSWAX_SYMBOL), TOKEN_CONTRACT, memo );
     }
 
-    check(total_lswax_allocated <= g.incentives_bucket.amount, "overallocation of incentives_bucket");
+    check(total_lswax_allocated <= s.incentives_bucket.amount, "overallocation of incentives_bucket");
 
-    g.incentives_bucket.amount      -=  total_lswax_allocated;
-    g.last_incentive_distribution   =   now();
-    global_s.set(g, _self);
+    s.incentives_bucket.amount      -=  total_lswax_allocated;
+    s.last_incentive_distribution   =   now();
 
 }
 
 /**
  * Initializes the contract state.
  * 
- * NOTE: The `global` singleton, `rewards` singleton, 
+ * NOTE: The `state` and `config` singletons, `rewards` singleton, 
  * initial epoch, and `self_staker` will all be initialized.
  * Throws if `initial_reward_pool` is less than our WAX balance.
  * The initial reward distribution is set to begin 6 hours from initialization,
@@ -403,66 +411,65 @@ ACTION fusion::init(const asset& initial_reward_pool){
     auto balance_itr = wax_table.require_find( WAX_SYMBOL.code().raw(), "no WAX balance found" );
     check( balance_itr->balance >= initial_reward_pool, "we don't have enough WAX to cover the initial_reward_pool" );
 
-    check( !global_s.exists(), "global singleton already exists" );
+    check( !state_s.exists(), "state singleton already exists" );
     check( !rewards_s.exists(), "rewards singleton already exists" );
 
-    global g{};
-    g.swax_currently_earning            = ZERO_SWAX;
-    g.swax_currently_backing_lswax      = ZERO_SWAX;
-    g.liquified_swax                    = ZERO_LSWAX;
-    g.revenue_awaiting_distribution     = ZERO_WAX;
-    g.total_revenue_distributed         = initial_reward_pool;
-    g.wax_for_redemption                = ZERO_WAX;
-    g.last_epoch_start_time             = now();
-    g.wax_available_for_rentals         = ZERO_WAX;
-    g.cost_to_rent_1_wax                = asset(120000, WAX_SYMBOL); /* 0.01 WAX per day */
-    g.current_cpu_contract              = "cpu1.fusion"_n;
-    g.next_stakeall_time                = now() + 60 * 60 * 24;    
-    g.last_incentive_distribution       = 0;
-    g.incentives_bucket                 = ZERO_LSWAX;
-    g.total_value_locked                = initial_reward_pool;
-    g.total_shares_allocated            = 0;
-    g.minimum_stake_amount              = eosio::asset(100000000, WAX_SYMBOL);
-    g.last_compound_time                = now();
-    g.minimum_unliquify_amount          = eosio::asset(100000000, LSWAX_SYMBOL);
-    g.initial_epoch_start_time          = now();
-    g.cpu_rental_epoch_length_seconds   = days_to_seconds(14); /* 14 days */
-    g.seconds_between_epochs            = days_to_seconds(7); /* 7 days */
-    g.user_share_1e6                    = 85 * SCALE_FACTOR_1E6;
-    g.pol_share_1e6                     = 7 * SCALE_FACTOR_1E6;
-    g.ecosystem_share_1e6               = 8 * SCALE_FACTOR_1E6;
-    g.admin_wallets = {
+    state   s{};
+    config  c{};
+    s.swax_currently_earning            = ZERO_SWAX;
+    s.swax_currently_backing_lswax      = ZERO_SWAX;
+    s.liquified_swax                    = ZERO_LSWAX;
+    s.revenue_awaiting_distribution     = ZERO_WAX;
+    s.total_revenue_distributed         = initial_reward_pool;
+    s.wax_for_redemption                = ZERO_WAX;
+    s.last_epoch_start_time             = now();
+    s.wax_available_for_rentals         = ZERO_WAX;
+    c.cost_to_rent_1_wax                = asset(120000, WAX_SYMBOL); /* 0.01 WAX per day */
+    s.current_cpu_contract              = "cpu1.fusion"_n;
+    s.next_stakeall_time                = now() + 60 * 60 * 24;    
+    s.last_incentive_distribution       = 0;
+    s.incentives_bucket                 = ZERO_LSWAX;
+    c.total_value_locked                = initial_reward_pool;
+    c.total_shares_allocated            = 0;
+    c.minimum_stake_amount              = eosio::asset(100000000, WAX_SYMBOL);
+    s.last_compound_time                = now();
+    c.minimum_unliquify_amount          = eosio::asset(100000000, LSWAX_SYMBOL);
+    c.initial_epoch_start_time          = now();
+    s.cpu_rental_epoch_length_seconds   = days_to_seconds(14); /* 14 days */
+    s.seconds_between_epochs            = days_to_seconds(7); /* 7 days */
+    c.user_share_1e6                    = 85 * SCALE_FACTOR_1E6;
+    c.pol_share_1e6                     = 7 * SCALE_FACTOR_1E6;
+    c.ecosystem_share_1e6               = 8 * SCALE_FACTOR_1E6;
+    c.admin_wallets = {
         "guild.waxdao"_n,
         "oig"_n,
         _self,
         "admin.wax"_n
     };
-    g.cpu_contracts = {
+    c.cpu_contracts = {
         "cpu1.fusion"_n,
         "cpu2.fusion"_n,
         "cpu3.fusion"_n
     };
-    g.redemption_period_length_seconds  = days_to_seconds(2); /* 2 days */
-    g.seconds_between_stakeall          = days_to_seconds(1); /* once per day */
-    g.fallback_cpu_receiver             = "updatethings"_n;
-    g.protocol_fee_1e6                  = 50000; /* 0.05% */
-    g.total_rewards_claimed             = ZERO_WAX;
-    global_s.set(g, _self);
-
-    create_epoch( g, now(), "cpu1.fusion"_n, ZERO_WAX );
-
-    staker_t.emplace(_self, [&](auto &row){
-        row.wallet                  = _self;
-        row.swax_balance            = ZERO_SWAX;
-        row.last_update             = now();
-        row.claimable_wax           = ZERO_WAX;
-        row.userRewardPerTokenPaid  = 0;     
-    });
+    s.redemption_period_length_seconds  = days_to_seconds(2); /* 2 days */
+    c.seconds_between_stakeall          = days_to_seconds(1); /* once per day */
+    c.fallback_cpu_receiver             = "updatethings"_n;
+    c.protocol_fee_1e6                  = 50000; /* 0.05% */
+    s.total_rewards_claimed             = ZERO_WAX;
+    state_s.set(s, _self);
+    config_s.set(c, _self);
+
+    create_epoch( s, now(), "cpu1.fusion"_n, ZERO_WAX );
+
+    staker_handle self_staker = find_staker(_self);
+    self_staker.last_update             = now();
+    self_staker.userRewardPerTokenPaid  = 0;
+    self_staker.save(_self);
 
     rewards r{};
     r.periodStart           = now() + (60*60*6); /* 6 hours from now */
     r.periodFinish          = now() + (60*60*6) + STAKING_FARM_DURATION;
-    r.rewardRate            = mulDiv128( uint128_t(initial_reward_pool.amount), SCALE_FACTOR_1E8, uint128_t(STAKING_FARM_DURATION) );
+    r.rewardRate            = fixed_point::mul_div( uint64_t(initial_reward_pool.amount), uint64_t(SCALE_FACTOR_1E8), uint128_t(STAKING_FARM_DURATION) );
     r.rewardsDuration       = STAKING_FARM_DURATION;
     r.lastUpdateTime        = now();
     r.rewardPerTokenStored  = 0;
@@ -488,39 +495,19 @@ ACTION fusion::inittop21() {
 
     auto idx = _producers.get_index<"prototalvote"_n>();
 
-    using value_type = std::pair<eosio::producer_authority, uint16_t>;
-    std::vector< value_type > top_producers;
-    top_producers.reserve(21);
-
-    for ( auto it = idx.cbegin(); it != idx.cend() && top_producers.size() < 21 && 0 < it->total_votes && it->active(); ++it ) {
-        top_producers.emplace_back(
-        eosio::producer_authority{
-            .producer_name = it->owner,
-            .authority     = it->get_producer_authority()
-        },
-        it->location
-        );
-    }
+    top21_names top_producers;
+    size_t      count = 0;
 
-    if ( top_producers.size() < MINIMUM_PRODUCERS_TO_VOTE_FOR ) {
-        check( false, ("attempting to vote for " + std::to_string( top_producers.size() ) + " producers but need to vote for " + std::to_string( MINIMUM_PRODUCERS_TO_VOTE_FOR ) ).c_str() );
+    for ( auto it = idx.cbegin(); it != idx.cend() && count < top_producers.size() && 0 < it->total_votes && it->active(); ++it ) {
+        top_producers[count++] = it->owner;
     }
 
-    std::sort(top_producers.begin(), top_producers.end(),
-    [](const value_type & a, const value_type & b) -> bool {
-        return a.first.producer_name.to_string() < b.first.producer_name.to_string();
-    }
-             );
-
-    std::vector<eosio::name> producers_to_vote_for {};
-
-    for (auto t : top_producers) {
-        producers_to_vote_for.push_back(t.first.producer_name);
-    }
+    std::vector<eosio::name> producers_to_vote_for = sort_top21( top_producers, count );
 
     top21 t{};
     t.block_producers = producers_to_vote_for;
     t.last_update = now();
+    t.version.emplace(1);
     top21_s.set(t, _self);
 
 }
@@ -542,51 +529,26 @@ ACTION fusion::inittop21() {
 
     check(!top21_s.exists(), "top21 already exists");
 
-    auto idx = _producers.get_index<"prototalvote"_n>();
-
-
-    using value_type = std::pair<eosio::producer_authority, uint16_t>;
-    std::vector< value_type > top_producers;
-    top_producers.reserve(21);
+    top21_names top_producers;
+    size_t      count = 0;
 
     for ( auto it = _producers.begin(); it != _producers.end()
             && 0 < it->total_votes
             ; ++it ) {
 
-        if (top_producers.size() == 21) break;
+        if (count == top_producers.size()) break;
         if (it->is_active) {
-
-            top_producers.emplace_back(
-            eosio::producer_authority{
-                .producer_name = it->owner,
-                .authority     = it->get_producer_authority()
-            },
-            it->location
-            );
-
+            top_producers[count++] = it->owner;
         }
 
     }
 
-    if ( top_producers.size() < MINIMUM_PRODUCERS_TO_VOTE_FOR ) {
-        check( false, ("attempting to vote for " + std::to_string( top_producers.size() ) + " producers but need to vote for " + std::to_string( MINIMUM_PRODUCERS_TO_VOTE_FOR ) ).c_str() );
-    }
-
-    std::sort(top_producers.begin(), top_producers.end(),
-    [](const value_type & a, const value_type & b) -> bool {
-        return a.first.producer_name.to_string() < b.first.producer_name.to_string();
-    }
-             );
-
-    std::vector<eosio::name> producers_to_vote_for {};
-
-    for (auto t : top_producers) {
-        producers_to_vote_for.push_back(t.first.producer_name);
-    }
+    std::vector<eosio::name> producers_to_vote_for = sort_top21( top_producers, count );
 
     top21 t{};
     t.block_producers = producers_to_vote_for;
     t.last_update = now();
+    t.version.emplace(1);
     top21_s.set(t, _self);
 
 }
@@ -611,40 +573,39 @@ ACTION fusion::instaredeem(const name& user, const asset& swax_to_redeem) {
 
     require_auth(user);
 
-    rewards r = rewards_s.get();    
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();    
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);      
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     r.totalSupply -= uint128_t(swax_to_redeem.amount);
 
     check( staker.swax_balance >= swax_to_redeem, "you are trying to redeem more than you have" );
     check( swax_to_redeem > ZERO_SWAX, "Must redeem a positive quantity" );
     check( swax_to_redeem.amount < MAX_ASSET_AMOUNT, "quantity too large" );
-    check( g.wax_available_for_rentals.amount >= swax_to_redeem.amount, "not enough instaredeem funds available" );
+    check( s.wax_available_for_rentals.amount >= swax_to_redeem.amount, "not enough instaredeem funds available" );
 
     staker.swax_balance -= swax_to_redeem;
 
-    modify_staker(staker);
-    modify_staker(self_staker); 
+    staker.save();
+    self_staker.save(); 
 
-    int64_t protocol_share  = calculate_asset_share( swax_to_redeem.amount, g.protocol_fee_1e6 );
-    int64_t user_share      = safecast::sub(swax_to_redeem.amount, protocol_share);
+    const config&   c               = config_s.get();
+    int64_t         protocol_share  = calculate_asset_share( swax_to_redeem.amount, c.protocol_fee_1e6 );
+    int64_t         user_share      = safecast::sub(swax_to_redeem.amount, protocol_share);
 
     check( safecast::add( protocol_share, user_share ) <= swax_to_redeem.amount, "error calculating protocol fee" );
 
-    g.wax_available_for_rentals.amount      -=  swax_to_redeem.amount;
-    g.revenue_awaiting_distribution.amount  +=  protocol_share;
-    g.swax_currently_earning.amount         -=  swax_to_redeem.amount;
-
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
+    s.wax_available_for_rentals.amount      -=  swax_to_redeem.amount;
+    s.revenue_awaiting_distribution.amount  +=  protocol_share;
+    s.swax_currently_earning.amount         -=  swax_to_redeem.amount;
 
     debit_user_redemptions_if_necessary(user, staker.swax_balance);
     retire_swax(swax_to_redeem.amount);
@@ -670,36 +631,34 @@ ACTION fusion::liquify(const name& user, const asset& quantity) {
     check(quantity > ZERO_SWAX, "Invalid quantity.");
     check(quantity.amount < MAX_ASSET_AMOUNT, "quantity too large");
 
-    rewards r = rewards_s.get();
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);  
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     check( staker.swax_balance >= quantity, "you are trying to liquify more than you have" );
 
     staker.swax_balance         -= quantity;
     self_staker.swax_balance    += quantity;
 
-    modify_staker(staker);
-    modify_staker(self_staker);
+    staker.save();
+    self_staker.save();
 
-    int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, g);
+    int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, s );
 
-    g.swax_currently_earning        -= quantity;
-    g.swax_currently_backing_lswax  += quantity;
-    g.liquified_swax.amount         += converted_lsWAX_i64;
+    s.swax_currently_earning        -= quantity;
+    s.swax_currently_backing_lswax  += quantity;
+    s.liquified_swax.amount         += converted_lsWAX_i64;
 
     issue_lswax(converted_lsWAX_i64, user);
     debit_user_redemptions_if_necessary(user, staker.swax_balance);
-
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
 }
 
 /**
@@ -727,39 +686,173 @@ ACTION fusion::liquifyexact(const name& user, const asset& quantity, const asset
     check(quantity.amount < MAX_ASSET_AMOUNT, "quantity too large");
     check(minimum_output.amount < MAX_ASSET_AMOUNT, "output quantity too large");
 
-    rewards r = rewards_s.get();
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);  
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     check( staker.swax_balance >= quantity, "you are trying to liquify more than you have" );
 
     staker.swax_balance         -= quantity;
     self_staker.swax_balance    += quantity;
 
-    modify_staker(staker);
-    modify_staker(self_staker);
-
-    int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, g);
-    check( converted_lsWAX_i64 >= minimum_output.amount, "output would be " + asset(converted_lsWAX_i64, LSWAX_SYMBOL).to_string() + " but expected " + minimum_output.to_string() );
+    staker.save();
+    self_staker.save();
 
-    g.swax_currently_earning        -= quantity;
-    g.swax_currently_backing_lswax  += quantity;
-    g.liquified_swax.amount         += converted_lsWAX_i64;
+    int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, s );
+    check( converted_lsWAX_i64 >= minimum_output.amount, [&]{ return "output would be " + asset(converted_lsWAX_i64, LSWAX_SYMBOL).to_string() + " but expected " + minimum_output.to_string(); } );
 
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
+    s.swax_currently_earning        -= quantity;
+    s.swax_currently_backing_lswax  += quantity;
+    s.liquified_swax.amount         += converted_lsWAX_i64;
 
     issue_lswax(converted_lsWAX_i64, user);
     debit_user_redemptions_if_necessary(user, staker.swax_balance);
 }
 
+/**
+ * Moves the legacy `lpfarms` and `incentiveids` rows into the `farms` table
+ * 
+ * NOTE: `incentiveids` rows for pools that are no longer in `lpfarms` only
+ * hold `pending_boosts` that can't be used anymore, so those are returned
+ * to the `incentives_bucket` instead of being migrated.
+ * 
+ * @required_auth - this contract
+ */
+
+ACTION fusion::migfarms() {
+    require_auth( _self );
+
+    check( lpfarms_t.begin() != lpfarms_t.end() || incent_ids_t.begin() != incent_ids_t.end(), "there are no farms left to migrate" );
+
+    for (auto lp_itr = lpfarms_t.begin(); lp_itr != lpfarms_t.end(); lp_itr = lpfarms_t.erase( lp_itr )) {
+        auto incent_itr = incent_ids_t.find( lp_itr->poolId );
+
+        farms_t.emplace(_self, [&](auto &_farm){
+            _farm.poolId                    = lp_itr->poolId;
+            _farm.symbol_to_incentivize     = lp_itr->symbol_to_incentivize;
+            _farm.contract_to_incentivize   = lp_itr->contract_to_incentivize;
+            _farm.percent_share_1e6         = lp_itr->percent_share_1e6;
+
+            if( incent_itr != incent_ids_t.end() ){
+                _farm.incentive_id          = incent_itr->incentive_id;
+                _farm.pending_boosts        = incent_itr->pending_boosts;
+            }
+        });
+
+        if( incent_itr != incent_ids_t.end() ) incent_ids_t.erase( incent_itr );
+    }
+
+    for (auto incent_itr = incent_ids_t.begin(); incent_itr != incent_ids_t.end(); incent_itr = incent_ids_t.erase( incent_itr )) {
+        if( incent_itr->pending_boosts > ZERO_LSWAX ){
+            state& s = state_s.modify();
+            s.incentives_bucket += incent_itr->pending_boosts;
+        }
+    }
+}
+
+/**
+ * Moves rows from the legacy `stakers` table into `stakers2`
+ * 
+ * NOTE: This can be called as many times as needed until there are
+ * no legacy rows left. The new rows are billed to this contract,
+ * since we can't bill RAM to users without their authorization.
+ * Erasing the legacy row refunds whoever paid for it.
+ * 
+ * @param limit - max amount of rows to migrate. Pass `0` for default (500)
+ * 
+ * @required_auth - this contract
+ */
+
+ACTION fusion::migstakers(const int& limit) {
+
+    require_auth(_self);
+
+    auto    staker_itr  = staker_t.begin();
+    int     rows_limit  = limit == 0 ? 500 : limit;
+    int     count       = 0;
+
+    check( staker_itr != staker_t.end(), "there are no stakers left to migrate" );
+
+    while (staker_itr != staker_t.end()) {
+        if (count == rows_limit) return;
+        staker_t_2.emplace(_self, [&](auto &_s){
+            _s.wallet                   = staker_itr->wallet;
+            _s.swax_balance             = staker_itr->swax_balance.amount;
+            _s.claimable_wax            = staker_itr->claimable_wax.amount;
+            _s.last_update              = uint32_t(staker_itr->last_update);
+            _s.userRewardPerTokenPaid   = staker_itr->userRewardPerTokenPaid;
+        });
+        staker_itr = staker_t.erase( staker_itr );
+        count ++;
+    }
+}
+
+/**
+ * Allows anyone to remove epochs that are no longer needed
+ * 
+ * NOTE: An epoch can be removed once its redemption period is over
+ * and all of its rentals have been cleared by `unstakecpu`. Epochs are
+ * removed oldest first, and their totals are added to the `epocharchive`
+ * singleton. This keeps the `epochs` table down to the handful of epochs
+ * that are actually in use. Requests in `epochreqs` that were never
+ * claimed are swept before the epoch is removed.
+ * 
+ * @param limit - max amount of rows to remove. Pass `0` for default (10)
+ */
+
+ACTION fusion::pruneepochs(const int& limit) {
+
+    state&  s = state_s.modify();
+
+    sync_epoch( s );
+
+    if ( !epoch_archive_s.exists() ) epoch_archive_s.set( epoch_archive{}, _self );
+
+    epoch_archive&  a           = epoch_archive_s.modify();
+    auto            epoch_itr   = epochs_t.begin();
+    int             rows_limit  = limit == 0 ? 10 : limit;
+    int             count       = 0;
+
+    while (epoch_itr != epochs_t.end() && count < rows_limit) {
+        if (epoch_itr->redemption_period_end_time > now()) break;
+
+        renters_table renters_t = renters_table( _self, epoch_itr->start_time );
+        rentals_table rentals_t = rentals_table( _self, epoch_itr->start_time );
+        if (renters_t.begin() != renters_t.end() || rentals_t.begin() != rentals_t.end()) break;
+
+        // Requests that were never claimed can't be anymore, sweep them first
+        epoch_requests_table    epoch_requests_t    = epoch_requests_table( _self, epoch_itr->start_time );
+        auto                    req_itr             = epoch_requests_t.begin();
+
+        while (req_itr != epoch_requests_t.end() && count < rows_limit) {
+            req_itr = epoch_requests_t.erase( req_itr );
+            count ++;
+        }
+
+        if (req_itr != epoch_requests_t.end()) break;
+
+        a.epochs_pruned                     += 1;
+        a.last_pruned_epoch                 =  epoch_itr->start_time;
+        a.total_wax_bucket                  += epoch_itr->wax_bucket;
+        a.total_wax_to_refund               += epoch_itr->wax_to_refund;
+        a.total_cpu_funds_returned          += epoch_itr->total_cpu_funds_returned;
+        a.total_added_to_redemption_bucket  += epoch_itr->total_added_to_redemption_bucket;
+
+        epoch_itr = epochs_t.erase( epoch_itr );
+        count ++;
+    }
+
+    check( count > 0, "there are no epochs to prune" );
+}
+
 /**
  * Allows anyone to move unredeemed funds from redemption pool to rental pool
  * 
@@ -771,17 +864,15 @@ ACTION fusion::liquifyexact(const name& user, const asset& quantity, const asset
 
 ACTION fusion::reallocate() {
 
-    global g = global_s.get();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
-    check( now() > g.last_epoch_start_time + g.redemption_period_length_seconds, "redemption period has not ended yet" );
-    check( g.wax_for_redemption > ZERO_WAX, "there is no wax to reallocate" );
+    check( now() > s.last_epoch_start_time + s.redemption_period_length_seconds, "redemption period has not ended yet" );
+    check( s.wax_for_redemption > ZERO_WAX, "there is no wax to reallocate" );
 
-    g.wax_available_for_rentals +=  g.wax_for_redemption;
-    g.wax_for_redemption        =   ZERO_WAX;
-
-    global_s.set(g, _self);
+    s.wax_available_for_rentals +=  s.wax_for_redemption;
+    s.wax_for_redemption        =   ZERO_WAX;
 }
 
 /**
@@ -796,53 +887,56 @@ ACTION fusion::redeem(const name& user) {
 
     require_auth(user);
 
-    rewards r = rewards_s.get();
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);      
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
-    modify_staker(self_staker);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
+    self_staker.save();
 
-    uint64_t redemption_start_time  = g.last_epoch_start_time;
-    uint64_t redemption_end_time    = g.last_epoch_start_time + g.redemption_period_length_seconds;
-    uint64_t epoch_to_claim_from    = g.last_epoch_start_time - g.cpu_rental_epoch_length_seconds;
+    uint64_t redemption_start_time  = s.last_epoch_start_time;
+    uint64_t redemption_end_time    = s.last_epoch_start_time + s.redemption_period_length_seconds;
+    uint64_t epoch_to_claim_from    = s.last_epoch_start_time - s.cpu_rental_epoch_length_seconds;
 
     check( now() < redemption_end_time,
-           ( "next redemption does not start until " + std::to_string(g.last_epoch_start_time + g.seconds_between_epochs) ).c_str()
+           [&]{ return "next redemption does not start until " + std::to_string(s.last_epoch_start_time + s.seconds_between_epochs); }
          );
 
-    requests_tbl requests_t = requests_tbl(get_self(), user.value);
-    auto req_itr = requests_t.require_find(epoch_to_claim_from, "you don't have a redemption request for the current redemption period");
+    user_requests       requests    = get_requests(user);
+    redemption_slot*    slot        = requests.find_slot(epoch_to_claim_from);
+
+    check( slot != nullptr, "you don't have a redemption request for the current redemption period" );
+
+    asset amount_requested = asset(slot->wax_amount_requested, WAX_SYMBOL);
 
     // Sanity check, this should never happen because the amounts were validated when the request was created
-    check( req_itr->wax_amount_requested.amount <= staker.swax_balance.amount, "you are trying to redeem more than you have" );
-    check( g.wax_for_redemption >= req_itr->wax_amount_requested, "not enough wax in the redemption pool" );
+    check( amount_requested.amount <= staker.swax_balance.amount, "you are trying to redeem more than you have" );
+    check( s.wax_for_redemption >= amount_requested, "not enough wax in the redemption pool" );
 
-    r.totalSupply       -= uint128_t(req_itr->wax_amount_requested.amount);
-    staker.swax_balance -= asset(req_itr->wax_amount_requested.amount, SWAX_SYMBOL);
-    modify_staker(staker);
+    r.totalSupply       -= uint128_t(amount_requested.amount);
+    staker.swax_balance -= asset(amount_requested.amount, SWAX_SYMBOL);
+    staker.save();
 
-    g.wax_for_redemption            -= req_itr->wax_amount_requested;
-    g.swax_currently_earning.amount -= req_itr->wax_amount_requested.amount;
-    
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
+    s.wax_for_redemption            -= amount_requested;
+    s.swax_currently_earning.amount -= amount_requested.amount;
 
-    retire_swax(req_itr->wax_amount_requested.amount);
-    transfer_tokens( user, req_itr->wax_amount_requested, WAX_CONTRACT, std::string("your sWAX redemption from waxfusion.io - liquid staking protocol") );
+    retire_swax(amount_requested.amount);
+    transfer_tokens( user, amount_requested, WAX_CONTRACT, std::string("your sWAX redemption from waxfusion.io - liquid staking protocol") );
 
-    requests_t.erase(req_itr);
+    *slot = redemption_slot{};
+    save_requests(requests);
 }
 
 /**
- * Removes an admin_wallet from the global singleton
+ * Removes an admin_wallet from the config singleton
  * 
- * @param admin_to_remove - the wallet to remove from the global state
+ * @param admin_to_remove - the wallet to remove from the config
  * 
  * @required_auth - this contract
  */
@@ -850,13 +944,12 @@ ACTION fusion::redeem(const name& user) {
 ACTION fusion::removeadmin(const name& admin_to_remove) {
     require_auth(_self);
 
-    global  g   = global_s.get();
-    auto    itr = std::remove(g.admin_wallets.begin(), g.admin_wallets.end(), admin_to_remove);
+    config& c   = config_s.modify();
+    auto    itr = std::remove(c.admin_wallets.begin(), c.admin_wallets.end(), admin_to_remove);
 
-    check( itr != g.admin_wallets.end(), (admin_to_remove.to_string() + " is not an admin").c_str() );
+    check( itr != c.admin_wallets.end(), [&]{ return admin_to_remove.to_string() + " is not an admin"; } );
     
-    g.admin_wallets.erase(itr, g.admin_wallets.end());
-    global_s.set(g, _self);
+    c.admin_wallets.erase(itr, c.admin_wallets.end());
 
 }
 
@@ -879,64 +972,64 @@ ACTION fusion::reqredeem(const name& user, const asset& swax_to_redeem, const bo
 
     require_auth(user);
 
-    rewards r = rewards_s.get();
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);  
 
-    extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
-    modify_staker(self_staker); 
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
+    self_staker.save(); 
 
     check( swax_to_redeem > ZERO_SWAX, "Must redeem a positive quantity" );
     check( swax_to_redeem.amount < MAX_ASSET_AMOUNT, "quantity too large" );
 
-    bool    request_can_be_filled       = false;
-    asset   remaining_amount_to_fill    = swax_to_redeem;
+    user_requests   requests                    = get_requests(user);
+    bool            request_can_be_filled       = false;
+    asset           remaining_amount_to_fill    = swax_to_redeem;
 
-    handle_available_request( g, request_can_be_filled, staker, remaining_amount_to_fill );
+    handle_available_request( s, requests, request_can_be_filled, staker, remaining_amount_to_fill );
 
     if ( request_can_be_filled ) {
-        modify_staker(staker);
-        rewards_s.set(r, _self);
-        global_s.set(g, _self);
+        save_requests(requests);
+        staker.save();
         return;
     }
 
     check( staker.swax_balance >= remaining_amount_to_fill, "you are trying to redeem more than you have" );
 
     std::vector<uint64_t> epochs_to_check = {
-        g.last_epoch_start_time - g.seconds_between_epochs,
-        g.last_epoch_start_time,
-        g.last_epoch_start_time + g.seconds_between_epochs
+        s.last_epoch_start_time - s.seconds_between_epochs,
+        s.last_epoch_start_time,
+        s.last_epoch_start_time + s.seconds_between_epochs
     };
 
-    remove_existing_requests( epochs_to_check, staker, accept_replacing_prev_requests );
-    handle_new_request( epochs_to_check, request_can_be_filled, staker, remaining_amount_to_fill );
+    remove_existing_requests( epochs_to_check, requests, accept_replacing_prev_requests );
+    handle_new_request( s, epochs_to_check, requests, request_can_be_filled, remaining_amount_to_fill );
+    save_requests(requests);
 
     if ( !request_can_be_filled ) {
 
         // Sanity check, this should never happen
         // If epochs can't cover the request, the only other place the WAX should be is in `wax_available_for_rentals`
-        check( g.wax_available_for_rentals.amount >= remaining_amount_to_fill.amount, "Request amount is greater than amount in epochs and rental pool" );
+        check( s.wax_available_for_rentals.amount >= remaining_amount_to_fill.amount, "Request amount is greater than amount in epochs and rental pool" );
 
-        g.wax_available_for_rentals.amount  -= remaining_amount_to_fill.amount;
+        s.wax_available_for_rentals.amount  -= remaining_amount_to_fill.amount;
         staker.swax_balance                 -= remaining_amount_to_fill;
         transfer_tokens( user, asset( remaining_amount_to_fill.amount, WAX_SYMBOL ), WAX_CONTRACT, std::string("your redemption from waxfusion.io - liquid staking protocol") );
     }
 
-    modify_staker(staker);
-    rewards_s.set(r, _self);
-    global_s.set(g, _self);
+    staker.save();
 }
 
 /**
- * Removes a CPU contract from the global singleton
+ * Removes a CPU contract from the config singleton
  * 
- * @param contract_to_remove - the CPU contract to remove from the global state
+ * @param contract_to_remove - the CPU contract to remove from the config
  * 
  * @required_auth - this contract
  */
@@ -944,17 +1037,19 @@ ACTION fusion::reqredeem(const name& user, const asset& swax_to_redeem, const bo
 ACTION fusion::rmvcpucntrct(const name& contract_to_remove) {
     require_auth(_self);
 
-    global  g   = global_s.get();
-    auto    itr = std::remove(g.cpu_contracts.begin(), g.cpu_contracts.end(), contract_to_remove);
+    config& c   = config_s.modify();
+    auto    itr = std::remove(c.cpu_contracts.begin(), c.cpu_contracts.end(), contract_to_remove);
 
-    check( itr != g.cpu_contracts.end(), (contract_to_remove.to_string() + " is not a cpu contract").c_str() );
+    check( itr != c.cpu_contracts.end(), [&]{ return contract_to_remove.to_string() + " is not a cpu contract"; } );
 
-    g.cpu_contracts.erase(itr, g.cpu_contracts.end());
-    global_s.set(g, _self);
+    c.cpu_contracts.erase(itr, c.cpu_contracts.end());
 }
 
 /**
- * Removes an LP incentive from the `lp_farms` table
+ * Removes an LP incentive from the `farms` table
+ * 
+ * NOTE: Any `pending_boosts` for this pool can't be added to a farm
+ * anymore, so they are returned to the `incentives_bucket`
  * 
  * @param caller - the wallet of the admin calling this action
  * @param poolId - the poolId of the liquidity pair, in Alcor's `pools` table
@@ -965,19 +1060,25 @@ ACTION fusion::rmvcpucntrct(const name& contract_to_remove) {
 ACTION fusion::rmvincentive(const name& caller, const uint64_t& poolId) {
     require_auth( caller );
 
-    global  g       = global_s.get();
-    auto    lp_itr  = lpfarms_t.require_find( poolId, "this poolId doesn't exist in the lpfarms table" );
+    config& c           = config_s.modify();
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the global table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the global table" );
+    check( farms_are_migrated(), "run migfarms first" );
 
-    g.total_shares_allocated = safecast::sub( g.total_shares_allocated, lp_itr->percent_share_1e6 );
+    auto    farm_itr    = farms_t.require_find( poolId, "this poolId doesn't exist in the lpfarms table" );
 
-    lpfarms_t.erase( lp_itr );
-    global_s.set(g, _self);
+    c.total_shares_allocated = safecast::sub( c.total_shares_allocated, farm_itr->percent_share_1e6 );
+
+    if( farm_itr->pending_boosts > ZERO_LSWAX ){
+        state& s = state_s.modify();
+        s.incentives_bucket += farm_itr->pending_boosts;
+    }
+
+    farms_t.erase( farm_itr );
 }
 
 /**
- * Changes the `fallback_cpu_receiver` in the global singleton
+ * Changes the `fallback_cpu_receiver` in the config singleton
  * 
  * NOTE: Every 24 hours, unrented WAX is staked to the fallback receiver
  * in order to maximize APR for sWAX and lsWAX
@@ -985,19 +1086,18 @@ ACTION fusion::rmvincentive(const name& caller, const uint64_t& poolId) {
  * @param caller - the wallet that is submitting this transaction
  * @param receiver - the new `fallback_cpu_receiver`
  * 
- * @required_auth - any admin in the global singleton
+ * @required_auth - any admin in the config singleton
  */
 
 ACTION fusion::setfallback(const name& caller, const name& receiver) {
     require_auth(caller);
 
-    global g = global_s.get();
+    config& c = config_s.modify();
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the global table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the global table" );
     check( is_account(receiver), "cpu receiver is not a wax account" );
 
-    g.fallback_cpu_receiver = receiver;
-    global_s.set(g, _self);
+    c.fallback_cpu_receiver = receiver;
 }
 
 /**
@@ -1013,16 +1113,16 @@ ACTION fusion::setfallback(const name& caller, const name& receiver) {
  * @param minimum_new_incentive - minimum amount of LSWAX to create a farm with
  * @param new_incentive_fee - the fee that goes to POL when a user creates a new farm
  * 
- * @required_auth - any admin in the global singleton
+ * @required_auth - any admin in the config singleton
  */
 
 ACTION fusion::setincentcfg(const name& caller, const asset& minimum_new_incentive, const asset& new_incentive_fee){
     require_auth( caller );
 
-    global      g   = global_s.get();
-    global2     g2  = global_s_2.get_or_create( _self, global2{} );
+    const config&   c   = config_s.get();
+    global2&        g2  = global_s_2.get_or_create( _self, global2{} );
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the global table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the global table" );
     check( minimum_new_incentive.symbol == LSWAX_SYMBOL, "minimum_new_incentive must be denomitated in LSWAX");
     check( new_incentive_fee.symbol == LSWAX_SYMBOL, "new_incentive_fee must be denomitated in LSWAX");
     check( minimum_new_incentive > new_incentive_fee, "minimum incentive must be greater than the fee" );
@@ -1035,7 +1135,7 @@ ACTION fusion::setincentcfg(const name& caller, const asset& minimum_new_incenti
 }
 
 /**
- * Adds or modifies an LP pair to the `lp_farms` table
+ * Adds or modifies an LP pair in the `farms` table
  * 
  * NOTE: Our ecosystem fund allocates a portion of protocol revenue to 
  * creating Alcor incentives for certain lsWAX pairs. This action allows
@@ -1053,10 +1153,11 @@ ACTION fusion::setincentcfg(const name& caller, const asset& minimum_new_incenti
 ACTION fusion::setincentive(const name& caller, const uint64_t& poolId, const eosio::symbol& symbol_to_incentivize, const eosio::name& contract_to_incentivize, const uint64_t& percent_share_1e6) {
     require_auth( caller );
 
-    global  g   = global_s.get();
+    config& c   = config_s.modify();
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the global table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the global table" );
     check(percent_share_1e6 > 0, "percent_share_1e6 must be positive");
+    check( farms_are_migrated(), "run migfarms first" );
 
     auto    itr = pools_t.require_find(poolId, "this poolId does not exist");
 
@@ -1068,42 +1169,40 @@ ACTION fusion::setincentive(const name& caller, const uint64_t& poolId, const eo
         check( false, "this poolId does not contain the symbol/contract combo you entered" );
     }
 
-    auto lp_itr = lpfarms_t.find( poolId );
+    auto farm_itr = farms_t.find( poolId );
 
-    if (lp_itr == lpfarms_t.end()) {
+    if (farm_itr == farms_t.end()) {
 
-        g.total_shares_allocated = safecast::add( g.total_shares_allocated, percent_share_1e6 );
+        c.total_shares_allocated = safecast::add( c.total_shares_allocated, percent_share_1e6 );
 
-        lpfarms_t.emplace(_self, [&](auto & _lp) {
-            _lp.poolId                  = poolId;
-            _lp.symbol_to_incentivize   = symbol_to_incentivize;
-            _lp.contract_to_incentivize = contract_to_incentivize;
-            _lp.percent_share_1e6       = percent_share_1e6;
+        farms_t.emplace(_self, [&](auto & _farm) {
+            _farm.poolId                    = poolId;
+            _farm.symbol_to_incentivize     = symbol_to_incentivize;
+            _farm.contract_to_incentivize   = contract_to_incentivize;
+            _farm.percent_share_1e6         = percent_share_1e6;
         });
 
     } else {
 
-        check( lp_itr->percent_share_1e6 != percent_share_1e6, "the share you entered is the same as the existing share" );
+        check( farm_itr->percent_share_1e6 != percent_share_1e6, "the share you entered is the same as the existing share" );
 
-        if ( lp_itr->percent_share_1e6 > percent_share_1e6 ) {
-            uint64_t difference         = safecast::sub( lp_itr->percent_share_1e6, percent_share_1e6 );
-            g.total_shares_allocated    = safecast::sub( g.total_shares_allocated, difference );
+        if ( farm_itr->percent_share_1e6 > percent_share_1e6 ) {
+            uint64_t difference         = safecast::sub( farm_itr->percent_share_1e6, percent_share_1e6 );
+            c.total_shares_allocated    = safecast::sub( c.total_shares_allocated, difference );
         } else {
-            uint64_t difference         = safecast::sub( percent_share_1e6, lp_itr->percent_share_1e6 );
-            g.total_shares_allocated    = safecast::add( g.total_shares_allocated, difference );
+            uint64_t difference         = safecast::sub( percent_share_1e6, farm_itr->percent_share_1e6 );
+            c.total_shares_allocated    = safecast::add( c.total_shares_allocated, difference );
         }
 
-        lpfarms_t.modify(lp_itr, _self, [&](auto & _lp) {
-            _lp.poolId                  = poolId;
-            _lp.symbol_to_incentivize   = symbol_to_incentivize;
-            _lp.contract_to_incentivize = contract_to_incentivize;
-            _lp.percent_share_1e6       = percent_share_1e6;
+        farms_t.modify(farm_itr, _self, [&](auto & _farm) {
+            _farm.symbol_to_incentivize     = symbol_to_incentivize;
+            _farm.contract_to_incentivize   = contract_to_incentivize;
+            _farm.percent_share_1e6         = percent_share_1e6;
         });
 
     }
 
-    check( g.total_shares_allocated <= ONE_HUNDRED_PERCENT_1E6, "total shares can not be > 100%" );
-    global_s.set( g, _self );
+    check( c.total_shares_allocated <= ONE_HUNDRED_PERCENT_1E6, "total shares can not be > 100%" );
 
 }
 
@@ -1122,13 +1221,12 @@ ACTION fusion::setpolshare(const uint64_t& pol_share_1e6) {
     require_auth( _self );
     check( pol_share_1e6 >= uint64_t(5 * SCALE_FACTOR_1E6) && pol_share_1e6 <= uint64_t(10 * SCALE_FACTOR_1E6), "acceptable range is 5-10%" );
 
-    global g = global_s.get();
-    g.pol_share_1e6 = pol_share_1e6;
-    global_s.set(g, _self);
+    config& c = config_s.modify();
+    c.pol_share_1e6 = pol_share_1e6;
 }
 
 /**
- * Sets the instant redemption fee in the `global` singleton
+ * Sets the instant redemption fee in the `config` singleton
  * 
  * NOTE: Values between 0 and 1% are allowed
  * 
@@ -1141,13 +1239,12 @@ ACTION fusion::setredeemfee(const uint64_t& protocol_fee_1e6) {
     require_auth( _self );
     check( protocol_fee_1e6 >= 0 && protocol_fee_1e6 <= uint64_t(SCALE_FACTOR_1E6), "acceptable range is 0-1%" );
 
-    global g = global_s.get();
-    g.protocol_fee_1e6 = protocol_fee_1e6;
-    global_s.set(g, _self);
+    config& c = config_s.modify();
+    c.protocol_fee_1e6 = protocol_fee_1e6;
 }
 
 /**
- * Sets the CPU rental price in the `global` singleton
+ * Sets the CPU rental price in the `config` singleton
  * 
  * NOTE: This also calls an inline action to set the CPU rental
  * price on the `pol.fusion` contract
@@ -1155,36 +1252,94 @@ ACTION fusion::setredeemfee(const uint64_t& protocol_fee_1e6) {
  * @param caller - the wax address of the wallet calling this action
  * @param cost_to_rent_1_wax - the amount of WAX that users will pay for renting 1 WAX for 1 day
  * 
- * @required_auth - any admin in the global singleton
+ * @required_auth - any admin in the config singleton
  */
 
 ACTION fusion::setrentprice(const name& caller, const asset& cost_to_rent_1_wax) {
     require_auth(caller);
 
-    global g = global_s.get();
+    config& c = config_s.modify();
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the config table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the config table" );
     check( cost_to_rent_1_wax > ZERO_WAX, "cost must be positive" );
 
-    g.cost_to_rent_1_wax = cost_to_rent_1_wax;
-    global_s.set(g, _self);
+    c.cost_to_rent_1_wax = cost_to_rent_1_wax;
 
+    flush_token_ops();
     action(active_perm(), POL_CONTRACT, "setrentprice"_n, std::tuple{ cost_to_rent_1_wax }).send();
 }
 
 ACTION fusion::setversion(const name& caller, const std::string& version_id, const std::string& changelog_url){
     require_auth(caller);
 
-    global  g = global_s.get();
+    const config& c = config_s.get();
     version v = version_s.get_or_create(_self, version{});
 
-    check( is_an_admin(g, caller), "this action requires auth from one of the admin_wallets in the config table" );
+    check( is_an_admin(c, caller), "this action requires auth from one of the admin_wallets in the config table" );
 
     v.version_id    = version_id;
     v.changelog_url = changelog_url;
     version_s.set(v, _self);
 }
 
+/**
+ * One time migration of the legacy `global` singleton into `state` and `config`
+ *
+ * NOTE: The `global` row is erased once its values have been copied, so
+ * the RAM it was using gets freed and nothing can accidentally read
+ * stale values from it later.
+ *
+ * @required_auth - this contract
+ */
+
+ACTION fusion::splitglobal() {
+    require_auth( _self );
+
+    check( global_s.exists(), "there is no global singleton to migrate" );
+    check( !state_s.exists(), "state singleton already exists" );
+
+    global  g = global_s.get();
+    state   s{};
+    config  c{};
+
+    s.swax_currently_earning            = g.swax_currently_earning;
+    s.swax_currently_backing_lswax      = g.swax_currently_backing_lswax;
+    s.liquified_swax                    = g.liquified_swax;
+    s.wax_available_for_rentals         = g.wax_available_for_rentals;
+    s.revenue_awaiting_distribution     = g.revenue_awaiting_distribution;
+    s.total_revenue_distributed         = g.total_revenue_distributed;
+    s.wax_for_redemption                = g.wax_for_redemption;
+    s.incentives_bucket                 = g.incentives_bucket;
+    s.total_rewards_claimed             = g.total_rewards_claimed;
+    s.last_epoch_start_time             = g.last_epoch_start_time;
+    s.current_cpu_contract              = g.current_cpu_contract;
+    s.seconds_between_epochs            = g.seconds_between_epochs;
+    s.cpu_rental_epoch_length_seconds   = g.cpu_rental_epoch_length_seconds;
+    s.redemption_period_length_seconds  = g.redemption_period_length_seconds;
+    s.next_stakeall_time                = g.next_stakeall_time;
+    s.last_incentive_distribution       = g.last_incentive_distribution;
+    s.last_compound_time                = g.last_compound_time;
+
+    c.cost_to_rent_1_wax                = g.cost_to_rent_1_wax;
+    c.minimum_stake_amount              = g.minimum_stake_amount;
+    c.minimum_unliquify_amount          = g.minimum_unliquify_amount;
+    c.total_value_locked                = g.total_value_locked;
+    c.total_shares_allocated            = g.total_shares_allocated;
+    c.initial_epoch_start_time          = g.initial_epoch_start_time;
+    c.user_share_1e6                    = g.user_share_1e6;
+    c.pol_share_1e6                     = g.pol_share_1e6;
+    c.ecosystem_share_1e6               = g.ecosystem_share_1e6;
+    c.protocol_fee_1e6                  = g.protocol_fee_1e6;
+    c.seconds_between_stakeall          = g.seconds_between_stakeall;
+    c.fallback_cpu_receiver             = g.fallback_cpu_receiver;
+    c.admin_wallets                     = g.admin_wallets;
+    c.cpu_contracts                     = g.cpu_contracts;
+
+    state_s.set(s, _self);
+    config_s.set(c, _self);
+    global_s.remove();
+}
+
 /**
  * Opens a row for `user` in the `stakers` table
  * 
@@ -1200,35 +1355,28 @@ ACTION fusion::stake(const name& user) {
 
     require_auth(user);
 
-    rewards r = rewards_s.get();
-    global  g = global_s.get();
+    rewards& r = rewards_s.modify();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
-    auto            staker_itr      = staker_t.find(user.value);
-    staker_struct   staker          = staker_itr != staker_t.end() ? staker_struct(*staker_itr) : staker_struct();
-    auto            self_staker_itr = staker_t.require_find( _self.value, ERR_STAKER_NOT_FOUND );
-    staker_struct   self_staker     = staker_struct(*self_staker_itr);
+    staker_handle   staker      = find_staker(user);
+    staker_handle   self_staker = get_staker(_self);
 
-    extend_reward(g, r, self_staker);
-    update_reward(self_staker, r);
+    extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(self_staker, r);
 
-    if (staker_itr != staker_t.end()) {
-        update_reward(staker, r);
-        modify_staker(staker);
+    if (staker.exists()) {
+        settle_reward(staker, r);
     } else {
-        staker_t.emplace(user, [&](auto & _s) {
-            _s.wallet                   = user;
-            _s.swax_balance             = ZERO_SWAX;
-            _s.claimable_wax            = ZERO_WAX;
-            _s.last_update              = now();
-            _s.userRewardPerTokenPaid   = r.rewardPerTokenStored;
-        });
+        staker.last_update              = now();
+        staker.userRewardPerTokenPaid   = r.rewardPerTokenStored;
     }
 
-    modify_staker(self_staker);
-    rewards_s.set(r, _self);
-    global_s.set(g, _self); 
+    staker.save(user);
+
+    self_staker.save();
 }
 
 /**
@@ -1240,35 +1388,36 @@ ACTION fusion::stake(const name& user) {
 
 ACTION fusion::stakeallcpu() {
     
-    global      g   = global_s.get();
-    global2     g2  = global_s_2.get_or_create( _self, global2{} );
+    state&          s   = state_s.modify();
+    const global2&  g2  = global_s_2.get_or_create( _self, global2{} );
+
+    sync_epoch( s );
 
-    sync_epoch( g );
+    check( now() >= s.next_stakeall_time, [&]{ return "next stakeall time is not until " + std::to_string(s.next_stakeall_time); } );
 
-    check( now() >= g.next_stakeall_time, ( "next stakeall time is not until " + std::to_string(g.next_stakeall_time) ).c_str() );
+    const config& c = config_s.get();
 
-    if (g2.stake_unused_funds && g.wax_available_for_rentals.amount > 0) {
+    if (g2.stake_unused_funds && s.wax_available_for_rentals.amount > 0) {
 
-        name        next_cpu_contract       = get_next_cpu_contract( g );
-        uint64_t    next_epoch_start_time   = g.last_epoch_start_time + g.seconds_between_epochs;
+        name        next_cpu_contract       = get_next_cpu_contract( s, c );
+        uint64_t    next_epoch_start_time   = s.last_epoch_start_time + s.seconds_between_epochs;
         auto        next_epoch_itr          = epochs_t.find(next_epoch_start_time);
 
-        transfer_tokens( next_cpu_contract, g.wax_available_for_rentals, WAX_CONTRACT, cpu_stake_memo(g.fallback_cpu_receiver, next_epoch_start_time) );
+        transfer_tokens( next_cpu_contract, s.wax_available_for_rentals, WAX_CONTRACT, cpu_stake_memo(c.fallback_cpu_receiver, next_epoch_start_time) );
 
         if (next_epoch_itr == epochs_t.end()) {
-            create_epoch( g, next_epoch_start_time, next_cpu_contract, g.wax_available_for_rentals );
+            create_epoch( s, next_epoch_start_time, next_cpu_contract, s.wax_available_for_rentals );
         } else {
             epochs_t.modify(next_epoch_itr, get_self(), [&](auto & _e) {
-                _e.wax_bucket += g.wax_available_for_rentals;
+                _e.wax_bucket += s.wax_available_for_rentals;
             });
         }
 
-        g.wax_available_for_rentals = ZERO_WAX;
+        s.wax_available_for_rentals = ZERO_WAX;
     }
 
-    uint64_t periods_passed = ( now() - g.next_stakeall_time + g.seconds_between_stakeall - 1 ) / g.seconds_between_stakeall;
-    g.next_stakeall_time += ( periods_passed * g.seconds_between_stakeall );
-    global_s.set(g, _self);
+    uint64_t periods_passed = ( now() - s.next_stakeall_time + c.seconds_between_stakeall - 1 ) / c.seconds_between_stakeall;
+    s.next_stakeall_time += ( periods_passed * c.seconds_between_stakeall );
 }
 
 /**
@@ -1284,28 +1433,28 @@ ACTION fusion::stakeallcpu() {
  * 
  * @param caller - the wallet address submitting this transaction
  * 
- * @required_auth - any admin in the global singleton
+ * @required_auth - any admin in the config singleton
  */
 
 ACTION fusion::sync(const name& caller) {
 
     require_auth( caller );
 
-    global g = global_s.get();
+    state&  s = state_s.modify();
+    const config& c = config_s.get();
 
-    check( is_an_admin( g, caller ), ( caller.to_string() + " is not an admin" ).c_str() );
+    check( is_an_admin( c, caller ), [&]{ return caller.to_string() + " is not an admin"; } );
 
-    sync_epoch( g );
+    sync_epoch( s );
 
-    name        next_cpu_contract       = get_next_cpu_contract( g );
-    uint64_t    next_epoch_start_time   = g.last_epoch_start_time + g.seconds_between_epochs;
+    name        next_cpu_contract       = get_next_cpu_contract( s, c );
+    uint64_t    next_epoch_start_time   = s.last_epoch_start_time + s.seconds_between_epochs;
     auto        next_epoch_itr          = epochs_t.find(next_epoch_start_time);
 
     if (next_epoch_itr == epochs_t.end()) {
-        create_epoch( g, next_epoch_start_time, next_cpu_contract, ZERO_WAX );
+        create_epoch( s, next_epoch_start_time, next_cpu_contract, ZERO_WAX );
     }
 
-    global_s.set(g, _self);
 }
 
 /**
@@ -1320,19 +1469,18 @@ ACTION fusion::sync(const name& caller) {
  * 
  * @param caller - wax address of the user submitting this transaction
  * 
- * @required_auth - caller (must be an admin in global singleton)
+ * @required_auth - caller (must be an admin in config singleton)
  */
 
 ACTION fusion::tgglstakeall(const name& caller) {
     require_auth( caller );
 
-    global  g   = global_s.get();
-    global2 g2  = global_s_2.get();
+    const config&   c   = config_s.get();
+    global2&        g2  = global_s_2.modify();
 
-    check( is_an_admin( g, caller ), ( caller.to_string() + " is not an admin" ).c_str() );
+    check( is_an_admin( c, caller ), [&]{ return caller.to_string() + " is not an admin"; } );
 
     g2.stake_unused_funds = !g2.stake_unused_funds;
-    global_s_2.set(g2, _self);
 }
 
 /**
@@ -1347,15 +1495,15 @@ ACTION fusion::tgglstakeall(const name& caller) {
 
 ACTION fusion::unstakecpu(const uint64_t& epoch_id, const int& limit) {
     
-    global g = global_s.get();
+    state&  s = state_s.modify();
 
-    sync_epoch( g );
+    sync_epoch( s );
 
-    uint64_t    epoch_to_check  = epoch_id == 0 ? g.last_epoch_start_time - g.seconds_between_epochs : epoch_id;
-    auto        epoch_itr       = epochs_t.require_find( epoch_to_check, ("could not find epoch " + std::to_string( epoch_to_check ) ).c_str() );
+    uint64_t    epoch_to_check  = epoch_id == 0 ? s.last_epoch_start_time - s.seconds_between_epochs : epoch_id;
+    auto        epoch_itr       = require_find( epochs_t, epoch_to_check, [&]{ return "could not find epoch " + std::to_string( epoch_to_check ); } );
     int         rows_limit      = limit == 0 ? 500 : limit;
 
-    check( epoch_itr->time_to_unstake <= now(), ("can not unstake until another " + std::to_string( epoch_itr-> time_to_unstake - now() ) + " seconds has passed").c_str() );
+    check( epoch_itr->time_to_unstake <= now(), [&]{ return "can not unstake until another " + std::to_string( epoch_itr-> time_to_unstake - now() ) + " seconds has passed"; } );
 
     del_bandwidth_table del_tbl( SYSTEM_CONTRACT, epoch_itr->cpu_wallet.value );
 
@@ -1363,19 +1511,25 @@ ACTION fusion::unstakecpu(const uint64_t& epoch_id, const int& limit) {
         check( false, ( epoch_itr->cpu_wallet.to_string() + " has nothing to unstake" ).c_str() );
     }
 
+    flush_token_ops();
     action(active_perm(), epoch_itr->cpu_wallet, "unstakebatch"_n, std::tuple{ rows_limit }).send();
 
-    global_s.set(g, _self);
-
     renters_table   renters_t   = renters_table( _self, epoch_to_check );
-    auto            rental_itr  = renters_t.begin();
+    auto            renter_itr  = renters_t.begin();
+    rentals_table   rentals_t   = rentals_table( _self, epoch_to_check );
+    auto            rental_itr  = rentals_t.begin();
     int             count       = 0;
 
-    if ( renters_t.begin() == renters_t.end() ) return;
+    // Legacy rows first
+    while (renter_itr != renters_t.end()) {
+        if (count == rows_limit) return;
+        renter_itr = renters_t.erase( renter_itr );
+        count ++;
+    }
 
-    while (rental_itr != renters_t.end()) {
+    while (rental_itr != rentals_t.end()) {
         if (count == rows_limit) return;
-        rental_itr = renters_t.erase( rental_itr );
+        rental_itr = rentals_t.erase( rental_itr );
         count ++;
     }
 
@@ -1390,34 +1544,17 @@ ACTION fusion::updatetop21() {
 
     auto idx = _producers.get_index<"prototalvote"_n>();
 
-    using value_type = std::pair<eosio::producer_authority, uint16_t>;
-    std::vector< value_type > top_producers;
-    top_producers.reserve(21);
-
-    for ( auto it = idx.cbegin(); it != idx.cend() && top_producers.size() < 21 && 0 < it->total_votes && it->active(); ++it ) {
-        top_producers.emplace_back(
-        eosio::producer_authority{
-            .producer_name = it->owner,
-            .authority     = it->get_producer_authority()
-        },
-        it->location
-        );
-    }
-
-    if ( top_producers.size() < MINIMUM_PRODUCERS_TO_VOTE_FOR ) {
-        check( false, ("attempting to vote for " + std::to_string( top_producers.size() ) + " producers but need to vote for " + std::to_string( MINIMUM_PRODUCERS_TO_VOTE_FOR ) ).c_str() );
-    }
+    top21_names top_producers;
+    size_t      count = 0;
 
-    std::sort(top_producers.begin(), top_producers.end(),
-    [](const value_type & a, const value_type & b) -> bool {
-        return a.first.producer_name.to_string() < b.first.producer_name.to_string();
+    for ( auto it = idx.cbegin(); it != idx.cend() && count < top_producers.size() && 0 < it->total_votes && it->active(); ++it ) {
+        top_producers[count++] = it->owner;
     }
-             );
 
-    std::vector<eosio::name> producers_to_vote_for {};
+    std::vector<eosio::name> producers_to_vote_for = sort_top21( top_producers, count );
 
-    for (auto t : top_producers) {
-        producers_to_vote_for.push_back(t.first.producer_name);
+    if ( producers_to_vote_for != t.block_producers ) {
+        t.version.emplace( t.version.value_or(0) + 1 );
     }
 
     t.block_producers   = producers_to_vote_for;
@@ -10,11 +10,16 @@
 #include <eosio/singleton.hpp>
 #include <eosio/binary_extension.hpp>
 #include <eosio/producer_schedule.hpp>
+#include "../../include/memo.hpp"
 #include <constants.hpp>
 #include <safecast.hpp>
+#include "../../include/fixed_point.hpp"
+#include "../../include/lazy_check.hpp"
 #include <tables.hpp>
 #include <structs.hpp>
+#include <staker_handle.hpp>
 #include <global.hpp>
+#include "../../include/lazy_singleton.hpp"
 #include <voting.hpp>
 
 using namespace eosio;
@@ -26,14 +31,26 @@ CONTRACT fusion : public contract {
 
         fusion(name receiver, name code, datastream<const char *> ds):
         contract(receiver, code, ds),
+        config_s(receiver, receiver.value),
+        epoch_archive_s(receiver, receiver.value),
         global_s(receiver, receiver.value),
         global_s_2(receiver, receiver.value),
         rewards_s(receiver, receiver.value),
+        state_s(receiver, receiver.value),
         pol_state_s_3(POL_CONTRACT, POL_CONTRACT.value),
         top21_s(receiver, receiver.value),
         version_s(receiver, receiver.value)
         {}      
 
+        ~fusion() {
+            flush_token_ops();
+            config_s.flush();
+            epoch_archive_s.flush();
+            global_s_2.flush();
+            rewards_s.flush();
+            state_s.flush();
+        }
+
         //Main Actions
         ACTION addadmin(const name& admin_to_add);
         ACTION addcpucntrct(const name& contract_to_add);
@@ -50,6 +67,9 @@ CONTRACT fusion : public contract {
         ACTION instaredeem(const name& user, const asset& swax_to_redeem);
         ACTION liquify(const name& user, const asset& quantity);
         ACTION liquifyexact(const name& user, const asset& quantity, const asset& minimum_output);
+        ACTION migfarms();
+        ACTION migstakers(const int& limit);
+        ACTION pruneepochs(const int& limit);
         ACTION reallocate();
         ACTION redeem(const name& user);
         ACTION removeadmin(const name& admin_to_remove);
@@ -63,6 +83,7 @@ CONTRACT fusion : public contract {
         ACTION setredeemfee(const uint64_t& protocol_fee_1e6);
         ACTION setrentprice(const name& caller, const asset& cost_to_rent_1_wax);
         ACTION setversion(const name& caller, const std::string& version_id, const std::string& changelog_url);
+        ACTION splitglobal();
         ACTION stake(const name& user);
         ACTION stakeallcpu();
         ACTION sync(const name& caller);
@@ -72,76 +93,101 @@ CONTRACT fusion : public contract {
 
         //Readonly Actions
         [[eosio::action, eosio::read_only]] uint64_t showexpcpu(const uint64_t& epoch_id);
+        [[eosio::action, eosio::read_only]] vector<lpfarms> showlpfarms();
         [[eosio::action, eosio::read_only]] bool showrefunds();
         [[eosio::action, eosio::read_only]] asset showreward(const name& user);     
         [[eosio::action, eosio::read_only]] vector<name> showvoterwds();
 
         //Notifications
-        [[eosio::on_notify("*::transfer")]] void receive_token_transfer(name from, name to, eosio::asset quantity, std::string memo);
+        [[eosio::on_notify("eosio.token::transfer")]] void receive_wax_transfer(name from, name to, eosio::asset quantity, std::string memo);
+        [[eosio::on_notify("token.fusion::transfer")]] void receive_lswax_transfer(name from, name to, eosio::asset quantity, std::string memo);
 
     private:
 
         //Singletons
-        pol_contract::state_singleton_3     pol_state_s_3;
-        global_singleton                    global_s;
-        global_singleton_2                  global_s_2;
-        rewards_singleton                   rewards_s;
-        top21_singleton                     top21_s;
-        version_singleton                   version_s;
+        pol_contract::state_singleton_3                 pol_state_s_3;
+        lazy_singleton<"config"_n, config>              config_s;
+        lazy_singleton<"epocharchive"_n, epoch_archive> epoch_archive_s;
+        global_singleton                                global_s;
+        lazy_singleton<"global2"_n, global2>            global_s_2;
+        lazy_singleton<"rewards"_n, rewards>            rewards_s;
+        lazy_singleton<"state"_n, state>                state_s;
+        top21_singleton                                 top21_s;
+        version_singleton                               version_s;
 
         //Multi Index Tables
         alcor_contract::incentives_table    incentives_t    = alcor_contract::incentives_table(ALCOR_CONTRACT, ALCOR_CONTRACT.value);
         alcor_contract::pools_table         pools_t         = alcor_contract::pools_table(ALCOR_CONTRACT, ALCOR_CONTRACT.value);
         epochs_table                        epochs_t        = epochs_table(get_self(), get_self().value);
+        farms_table                         farms_t         = farms_table(get_self(), get_self().value);
         incentive_ids_table                 incent_ids_t    = incentive_ids_table(get_self(), get_self().value);
         lpfarms_table                       lpfarms_t       = lpfarms_table(get_self(), get_self().value);
         producers_table                     _producers      = producers_table(SYSTEM_CONTRACT, SYSTEM_CONTRACT.value);
         staker_table                        staker_t        = staker_table(get_self(), get_self().value);
+        staker_table_2                      staker_t_2      = staker_table_2(get_self(), get_self().value);
+        user_requests_table                 requests_t      = user_requests_table(get_self(), get_self().value);
+
+        //Queued token.fusion operations, sent as one `batch` action by `flush_token_ops`
+        vector<token_op>                    token_ops;
 
 
         //Functions
         inline eosio::permission_level active_perm();
         int64_t calculate_asset_share(const int64_t& quantity, const uint64_t& percentage);
-        int64_t calculate_lswax_output(const int64_t& quantity, global& g);
-        int64_t calculate_swax_output(const int64_t& quantity, global& g);
+        int64_t calculate_lswax_output(const int64_t& quantity, state& s);
+        int64_t calculate_swax_output(const int64_t& quantity, state& s);
         string cpu_stake_memo(const name& cpu_receiver, const uint64_t& epoch_timestamp);
         void create_alcor_farm(const uint64_t& poolId, const symbol& token_symbol, const name& token_contract, const uint32_t& duration);
-        void create_epoch(const global& g, const uint64_t& start_time, const name& cpu_wallet, const asset& wax_bucket);
+        void create_epoch(const state& s, const uint64_t& start_time, const name& cpu_wallet, const asset& wax_bucket);
         uint64_t days_to_seconds(const uint64_t& days);
         void debit_user_redemptions_if_necessary(const name& user, const asset& swax_balance);
-        eosio::name get_next_cpu_contract(global& g);
-        uint64_t get_seconds_to_rent_cpu(global& g, const uint64_t& epoch_id_to_rent_from);
-        vector<string> get_words(string memo);
-        bool is_an_admin(global& g, const name& user);
-        bool is_cpu_contract(global& g, const name& contract);
+        bool farms_are_migrated();
+        void flush_token_ops();
+        rentals_table::const_iterator find_rental(rentals_table& rentals_t, const name& renter, const name& receiver, uint64_t& free_key);
+        size_t get_cpu_contract_index(const state& s, const config& c);
+        eosio::name get_next_cpu_contract(const state& s, const config& c);
+        uint64_t get_seconds_to_rent_cpu(state& s, const uint64_t& epoch_id_to_rent_from);
+        MEMO_COMMAND get_lswax_memo_command(std::string_view memo, const memo::memo_words& words);
+        MEMO_COMMAND get_wax_memo_command(std::string_view memo, const memo::memo_words& words);
+        bool is_an_admin(const config& c, const name& user);
+        bool is_cpu_contract(const config& c, const name& contract);
         bool is_lswax_or_wax(const symbol& symbol, const name& contract);
         void issue_lswax(const int64_t& amount, const name& receiver);
         void issue_swax(const int64_t& amount);
-        bool memo_is_expected(const string& memo);
         inline uint64_t now();
-        inline void readonly_sync_epoch(global& g);
+        void queue_token_op(const name& op, const name& to, const asset& quantity, const string& memo);
+        inline void readonly_sync_epoch(state& s);
+        void reject_memo(const name& from, const MEMO_COMMAND& other_token_command);
         void retire_lswax(const int64_t& amount);
+        uint64_t rental_key(const name& renter, const name& receiver);
         void retire_swax(const int64_t& amount);
-        inline void sync_epoch(global& g);
+        vector<name> sort_top21(top21_names& producers, const size_t& count);
+        inline void sync_epoch(state& s);
         void transfer_tokens(const name& user, const asset& amount_to_send, const name& contract, const string& memo);
         void validate_allocations( const int64_t& quantity, const vector<int64_t> allocations );
 
         //Redemptions
-        void handle_available_request(global& g, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill);
-        void handle_new_request(vector<uint64_t>& epochs_to_check, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill);
-        void remove_existing_requests(vector<uint64_t>& epochs_to_check, staker_struct& staker, const bool& accept_replacing_prev_requests);
+        user_requests get_requests(const name& user);
+        void handle_available_request(state& s, user_requests& requests, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill);
+        void handle_new_request(state& s, vector<uint64_t>& epochs_to_check, user_requests& requests, bool& request_can_be_filled, asset& remaining_amount_to_fill);
+        void remove_existing_requests(vector<uint64_t>& epochs_to_check, user_requests& requests, const bool& accept_replacing_prev_requests);
+        void save_requests(const user_requests& requests);
+        void set_epoch_request(const uint64_t& epoch_id, const name& wallet, const int64_t& amount);
+        void update_epoch_requests(const user_requests& previous, const user_requests& requests);
 
         //Staking
+        void advance_reward(rewards& r);
         int64_t earned(staker_struct& staker, rewards& r);
-        void extend_reward(global&g, rewards& r, staker_struct& self_staker);
-        std::pair<staker_struct, staker_struct> get_stakers(const name& user);
-        int64_t max_reward(global& g, rewards& r);
-        void modify_staker(staker_struct& staker);
-        void readonly_extend_reward(global&g, rewards& r, staker_struct& self_staker);
-        int64_t readonly_max_reward(global& g, rewards& r);
+        void extend_reward(state& s, rewards& r, staker_struct& self_staker);
+        staker_handle find_staker(const name& user);
+        staker_handle get_staker(const name& user);
+        std::pair<staker_handle, staker_handle> get_stakers(const name& user);
+        int64_t max_reward(state& s, const config& c, rewards& r);
+        void readonly_extend_reward(state& s, rewards& r, staker_struct& self_staker);
+        int64_t readonly_max_reward(state& s, const config& c, rewards& r);
         uint128_t reward_per_token(rewards& r);
-        void update_reward(staker_struct& staker, rewards& r);  
-        void zero_distribution(global& g, rewards& r);  
+        void settle_reward(staker_struct& staker, rewards& r);
+        void zero_distribution(rewards& r);  
 
         //Safemath
         int64_t mulDiv(uint64_t a, uint64_t b, uint128_t denominator);
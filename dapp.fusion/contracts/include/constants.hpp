@@ -24,12 +24,60 @@ static const eosio::asset ZERO_WAX      = eosio::asset(0, WAX_SYMBOL);
 //Enums
 static const enum READONLY_CPU_RETURNS { NOT_FOUND, NOT_TIME_YET, NOTHING_TO_UNSTAKE };
 
+enum class MEMO_COMMAND : uint8_t {
+    NONE,
+    CPU_RENTAL_RETURN,
+    INSTANT_REDEEM,
+    LP_INCENTIVES,
+    NEW_INCENTIVE,
+    REBALANCE,
+    RENT_CPU,
+    STAKE,
+    UNLIQUIFY,
+    UNLIQUIFY_EXACT,
+    WAX_LSWAX_LIQUIDITY,
+    WAXFUSION_REVENUE
+};
+
+//Memos accepted with WAX (the whole memo has to match)
+static constexpr memo::memo_commands<MEMO_COMMAND, 5> WAX_MEMOS({{
+    { "cpu rental return",      MEMO_COMMAND::CPU_RENTAL_RETURN },
+    { "lp_incentives",          MEMO_COMMAND::LP_INCENTIVES },
+    { "stake",                  MEMO_COMMAND::STAKE },
+    { "wax_lswax_liquidity",    MEMO_COMMAND::WAX_LSWAX_LIQUIDITY },
+    { "waxfusion_revenue",      MEMO_COMMAND::WAXFUSION_REVENUE }
+}});
+
+//Memos with arguments accepted with WAX, e.g. |rent_cpu|receiver|amount|epoch|
+static constexpr memo::memo_commands<MEMO_COMMAND, 1> WAX_MEMO_WORD_COMMANDS({{
+    { "rent_cpu",               MEMO_COMMAND::RENT_CPU }
+}});
+
+//Memos accepted with LSWAX (the whole memo has to match)
+static constexpr memo::memo_commands<MEMO_COMMAND, 4> LSWAX_MEMOS({{
+    { "instant redeem",         MEMO_COMMAND::INSTANT_REDEEM },
+    { "lp_incentives",          MEMO_COMMAND::LP_INCENTIVES },
+    { "rebalance",              MEMO_COMMAND::REBALANCE },
+    { "unliquify",              MEMO_COMMAND::UNLIQUIFY }
+}});
+
+//Memos with arguments accepted with LSWAX, e.g. |unliquify_exact|minimum_output|
+static constexpr memo::memo_commands<MEMO_COMMAND, 2> LSWAX_MEMO_WORD_COMMANDS({{
+    { "new_incentive",          MEMO_COMMAND::NEW_INCENTIVE },
+    { "unliquify_exact",        MEMO_COMMAND::UNLIQUIFY_EXACT }
+}});
+
+static_assert( WAX_MEMOS.hashes_are_unique() && WAX_MEMO_WORD_COMMANDS.hashes_are_unique() );
+static_assert( LSWAX_MEMOS.hashes_are_unique() && LSWAX_MEMO_WORD_COMMANDS.hashes_are_unique() );
+
 //Other
 static constexpr uint64_t ONE_HUNDRED_PERCENT_1E6       = 100000000;
 static constexpr uint64_t LP_FARM_DURATION_SECONDS      = 604800; /* 1 week */
 static constexpr uint64_t MAXIMUM_WAX_TO_RENT           = 10000000; /* 10 Million WAX */
 static constexpr uint64_t MINIMUM_PRODUCERS_TO_VOTE_FOR = 16;
+static constexpr size_t   MAXIMUM_PRODUCERS_TO_VOTE_FOR = 21;
 static constexpr uint64_t MINIMUM_WAX_TO_RENT           = 10;
+static constexpr size_t   REDEMPTION_SLOTS              = 4;
 static constexpr uint64_t STAKING_FARM_DURATION         = 86400;
 
 //System Contract
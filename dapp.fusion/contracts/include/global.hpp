@@ -2,6 +2,11 @@
 
 #include <constants.hpp>
 
+/**
+ * Legacy singleton, only kept around so `splitglobal` can migrate it
+ * into `state` and `config`. Nothing else should read from it.
+ */
+
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] global {
     eosio::asset                swax_currently_earning;
     eosio::asset                swax_currently_backing_lswax;
@@ -72,6 +77,99 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] global {
 using global_singleton = eosio::singleton<"global"_n, global>;
 
 
+/**
+ * Accounting counters and epoch pointers that are read/written by almost
+ * every user action. Anything that only changes through admin actions
+ * lives in `config`, so user actions don't have to deserialize and
+ * rewrite the admin/cpu vectors every time.
+ * 
+ * NOTE: The epoch lengths are stored here instead of `config` since
+ * `sync_epoch` needs them on every action, and they never change after `init`.
+ * 
+ * NOTE: pol.fusion reads the first 4 fields of this row directly (and the first
+ * 3 fields of `config`), so new fields should only be added to the end.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] state {
+    eosio::asset    swax_currently_earning;
+    eosio::asset    swax_currently_backing_lswax;
+    eosio::asset    liquified_swax;
+    eosio::asset    wax_available_for_rentals;
+    eosio::asset    revenue_awaiting_distribution;
+    eosio::asset    total_revenue_distributed;
+    eosio::asset    wax_for_redemption;
+    eosio::asset    incentives_bucket;
+    eosio::asset    total_rewards_claimed;
+    uint64_t        last_epoch_start_time;
+    eosio::name     current_cpu_contract;
+    uint64_t        seconds_between_epochs;
+    uint64_t        cpu_rental_epoch_length_seconds;
+    uint64_t        redemption_period_length_seconds;
+    uint64_t        next_stakeall_time;
+    uint64_t        last_incentive_distribution;
+    uint64_t        last_compound_time;
+
+    EOSLIB_SERIALIZE(state,     (swax_currently_earning)
+                                (swax_currently_backing_lswax)
+                                (liquified_swax)
+                                (wax_available_for_rentals)
+                                (revenue_awaiting_distribution)
+                                (total_revenue_distributed)
+                                (wax_for_redemption)
+                                (incentives_bucket)
+                                (total_rewards_claimed)
+                                (last_epoch_start_time)
+                                (current_cpu_contract)
+                                (seconds_between_epochs)
+                                (cpu_rental_epoch_length_seconds)
+                                (redemption_period_length_seconds)
+                                (next_stakeall_time)
+                                (last_incentive_distribution)
+                                (last_compound_time)
+                    )
+};
+using state_singleton = eosio::singleton<"state"_n, state>;
+
+
+/**
+ * Protocol settings that only change through admin actions
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] config {
+    eosio::asset                cost_to_rent_1_wax;
+    eosio::asset                minimum_stake_amount;
+    eosio::asset                minimum_unliquify_amount;
+    eosio::asset                total_value_locked;
+    uint64_t                    total_shares_allocated;
+    uint64_t                    initial_epoch_start_time;
+    uint64_t                    user_share_1e6;
+    uint64_t                    pol_share_1e6;
+    uint64_t                    ecosystem_share_1e6;
+    uint64_t                    protocol_fee_1e6;
+    uint64_t                    seconds_between_stakeall;
+    eosio::name                 fallback_cpu_receiver;
+    std::vector<eosio::name>    admin_wallets;
+    std::vector<eosio::name>    cpu_contracts;
+
+    EOSLIB_SERIALIZE(config,    (cost_to_rent_1_wax)
+                                (minimum_stake_amount)
+                                (minimum_unliquify_amount)
+                                (total_value_locked)
+                                (total_shares_allocated)
+                                (initial_epoch_start_time)
+                                (user_share_1e6)
+                                (pol_share_1e6)
+                                (ecosystem_share_1e6)
+                                (protocol_fee_1e6)
+                                (seconds_between_stakeall)
+                                (fallback_cpu_receiver)
+                                (admin_wallets)
+                                (cpu_contracts)
+                    )
+};
+using config_singleton = eosio::singleton<"config"_n, config>;
+
+
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] global2 {
     uint64_t        max_staker_apr_1e6      = 12000000;
     eosio::asset    minimum_new_incentive   = eosio::asset( 10000000000, LSWAX_SYMBOL );   // 100 LSWAX
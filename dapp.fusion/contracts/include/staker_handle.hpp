@@ -0,0 +1,99 @@
+#pragma once
+
+/**
+ * A `staker_struct` that remembers which row it was loaded from.
+ *
+ * The iterator from the initial lookup is kept, so `save()` can go straight
+ * to `modify` without a second `require_find`. It also works for users that
+ * don't have a row yet, in which case `save(payer)` creates one in `stakers2`.
+ *
+ * NOTE: Rows that haven't been moved by `migstakers` yet are still read from,
+ * and written back to, the legacy `stakers` table.
+ *
+ * Since this derives from `staker_struct`, it can be passed to anything
+ * that takes a `staker_struct&` (e.g. `settle_reward`).
+ */
+
+class staker_handle : public staker_struct {
+    public:
+        staker_handle(staker_table_2& table_2, staker_table& table, const eosio::name& user):
+        _table_2(&table_2),
+        _table(&table),
+        _itr_2(table_2.find(user.value)),
+        _itr(table.end())
+        {
+            if ( _itr_2 != _table_2->end() ) {
+                staker_struct::operator=( staker_struct(*_itr_2) );
+                return;
+            }
+
+            _itr = _table->find(user.value);
+
+            if ( _itr != _table->end() ) {
+                staker_struct::operator=( staker_struct(*_itr) );
+                return;
+            }
+
+            wallet = user;
+        }
+
+        bool exists() const {
+            return _itr_2 != _table_2->end() || _itr != _table->end();
+        }
+
+        /** Writes back an existing row, skipping the write entirely if nothing changed */
+        void save() {
+            if ( _itr_2 != _table_2->end() ) {
+                if ( _itr_2->claimable_wax == claimable_wax.amount
+                    && _itr_2->swax_balance == swax_balance.amount
+                    && _itr_2->last_update == last_update
+                    && _itr_2->userRewardPerTokenPaid == userRewardPerTokenPaid
+                ) return;
+
+                _table_2->modify(_itr_2, eosio::same_payer, [&](auto &_s){
+                    _s.claimable_wax            = claimable_wax.amount;
+                    _s.swax_balance             = swax_balance.amount;
+                    _s.last_update              = uint32_t(last_update);
+                    _s.userRewardPerTokenPaid   = userRewardPerTokenPaid;
+                });
+                return;
+            }
+
+            eosio::check( _itr != _table->end(), ERR_STAKER_NOT_FOUND );
+
+            if ( _itr->claimable_wax == claimable_wax
+                && _itr->swax_balance == swax_balance
+                && _itr->last_update == last_update
+                && _itr->userRewardPerTokenPaid == userRewardPerTokenPaid
+            ) return;
+
+            _table->modify(_itr, eosio::same_payer, [&](auto &_s){
+                _s.claimable_wax            = claimable_wax;
+                _s.swax_balance             = swax_balance;
+                _s.last_update              = last_update;
+                _s.userRewardPerTokenPaid   = userRewardPerTokenPaid;
+            });
+        }
+
+        /** Same as `save()`, but creates the row in `stakers2` if it doesn't exist yet */
+        void save(const eosio::name& payer) {
+            if ( exists() ) {
+                save();
+                return;
+            }
+
+            _itr_2 = _table_2->emplace(payer, [&](auto &_s){
+                _s.wallet                   = wallet;
+                _s.swax_balance             = swax_balance.amount;
+                _s.claimable_wax            = claimable_wax.amount;
+                _s.last_update              = uint32_t(last_update);
+                _s.userRewardPerTokenPaid   = userRewardPerTokenPaid;
+            });
+        }
+
+    private:
+        staker_table_2*                 _table_2;
+        staker_table*                   _table;
+        staker_table_2::const_iterator  _itr_2;
+        staker_table::const_iterator    _itr;
+};
@@ -14,6 +14,19 @@ struct next_farm {
     next_farm() = default;
 };
 
+/** Producers collected by `inittop21`/`updatetop21`, before `sort_top21` */
+using top21_names = std::array<eosio::name, MAXIMUM_PRODUCERS_TO_VOTE_FOR>;
+
+/** One `issue`/`retire` operation for `token.fusion`'s `batch` action */
+struct token_op {
+    eosio::name     op;
+    eosio::name     to;
+    eosio::asset    quantity;
+    std::string     memo;
+
+    EOSLIB_SERIALIZE(token_op, (op)(to)(quantity)(memo))
+};
+
 struct staker_struct {
     eosio::name     wallet;
     eosio::asset    swax_balance = ZERO_SWAX;
@@ -27,6 +40,13 @@ struct staker_struct {
           last_update(staker.last_update),
           claimable_wax(staker.claimable_wax),
           userRewardPerTokenPaid(staker.userRewardPerTokenPaid) {}
+
+    staker_struct(const stakers2& staker)
+        : wallet(staker.wallet),
+          swax_balance(eosio::asset(staker.swax_balance, SWAX_SYMBOL)),
+          last_update(staker.last_update),
+          claimable_wax(eosio::asset(staker.claimable_wax, WAX_SYMBOL)),
+          userRewardPerTokenPaid(staker.userRewardPerTokenPaid) {}
     
     staker_struct() = default;  
 };
\ No newline at end of file
@@ -132,14 +132,63 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] epochs {
 };
 using epochs_table = eosio::multi_index<"epochs"_n, epochs>;
 
+
+/**
+ * Running totals for epochs that have been removed from the `epochs` table
+ * by `pruneepochs`. Only the last few epochs are ever needed by the contract,
+ * so this keeps the history without the table growing forever.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] epoch_archive {
+  uint64_t          epochs_pruned                       = 0;
+  uint64_t          last_pruned_epoch                   = 0;
+  eosio::asset      total_wax_bucket                    = ZERO_WAX;
+  eosio::asset      total_wax_to_refund                 = ZERO_WAX;
+  eosio::asset      total_cpu_funds_returned            = ZERO_WAX;
+  eosio::asset      total_added_to_redemption_bucket    = ZERO_WAX;
+
+  EOSLIB_SERIALIZE(epoch_archive, (epochs_pruned)
+                   (last_pruned_epoch)
+                   (total_wax_bucket)
+                   (total_wax_to_refund)
+                   (total_cpu_funds_returned)
+                   (total_added_to_redemption_bucket)
+                  )
+};
+using epoch_archive_singleton = eosio::singleton<"epocharchive"_n, epoch_archive>;
+
+/**
+ * The farms table is the registry of lsWAX pairs in the ecosystem fund.
+ * 
+ * Each row holds everything `createfarms` needs for a pool: the paired
+ * token, the share of the ecosystem fund, the id of the incentive we
+ * created on Alcor (empty until the first farm is created) and any
+ * `new_incentive` deposits waiting to be added to next week's farm.
+ * 
+ * NOTE: This replaces the `lpfarms` and `incentiveids` tables, which
+ * are kept below until `migfarms` has moved their rows over. Anything
+ * that still expects the `lpfarms` layout can use the `showlpfarms`
+ * readonly action.
+ * 
+ * Scoped by _self
+ */ 
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] farms {
+  uint64_t                  poolId;
+  eosio::symbol             symbol_to_incentivize;
+  eosio::name               contract_to_incentivize;
+  uint64_t                  percent_share_1e6;   // percentage of ecosystem fund, not percentage of total revenue
+  std::optional<uint64_t>   incentive_id;
+  eosio::asset              pending_boosts = ZERO_LSWAX;
+
+  uint64_t primary_key() const { return poolId; }
+};
+using farms_table = eosio::multi_index<"farms"_n, farms>;
+
 /**
  * The incentive_ids table stores the ids of incentives created on Alcor.
  * 
- * NOTE: The `lpfarms` table stores most of the data related to farms.
- * The idea to also store incentive ids came after the contract was already
- * on mainnet, so rather than modifying the existing table and potentially 
- * breaking other contracts/indexers, it was decided to create a second 
- * table as an extension instead.
+ * NOTE: Legacy, see `farms`. Rows are moved by `migfarms`.
  * 
  * Scoped by _self
  */ 
@@ -153,6 +202,7 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] incentive_ids {
 };
 using incentive_ids_table = eosio::multi_index<"incentiveids"_n, incentive_ids>;
 
+/** Legacy, see `farms`. Rows are moved by `migfarms` */
 
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] lpfarms {
   uint64_t                poolId;
@@ -241,6 +291,7 @@ eosio::indexed_by<"prototalvote"_n, eosio::const_mem_fun<producer_info, double,
 
 
 // Scoped by user
+// Legacy, rows are moved into `userrequests` the first time a user's requests are loaded
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] redeem_requests {
   uint64_t        epoch_id;
   eosio::asset    wax_amount_requested;
@@ -251,6 +302,77 @@ using requests_tbl = eosio::multi_index<"rdmrequests"_n, redeem_requests
                      >;
 
 
+struct redemption_slot {
+  uint64_t        epoch_id;               // 0 if the slot is empty
+  int64_t         wax_amount_requested;   // WAX, symbol is implied
+};
+
+/**
+ * All of a user's redemption requests, in a single row
+ * 
+ * NOTE: A request can be spread across the 3 epochs that are still
+ * waiting for their redemption period, and the epoch that is currently
+ * in its redemption period can still hold a request that hasn't been
+ * claimed yet. So 4 slots covers every request that can be live at once.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] user_requests {
+  eosio::name                                     wallet;
+  std::array<redemption_slot, REDEMPTION_SLOTS>   slots;
+
+  uint64_t primary_key() const { return wallet.value; }
+
+  redemption_slot* find_slot(const uint64_t& epoch_id) {
+    if ( epoch_id == 0 ) return nullptr;
+    for ( redemption_slot& slot : slots ) {
+      if ( slot.epoch_id == epoch_id ) return &slot;
+    }
+    return nullptr;
+  }
+
+  const redemption_slot* find_slot(const uint64_t& epoch_id) const {
+    return const_cast<user_requests*>(this)->find_slot(epoch_id);
+  }
+
+  // Empty slots, or slots for epochs that can no longer be redeemed, can be reused
+  redemption_slot* free_slot(const uint64_t& expired_before) {
+    for ( redemption_slot& slot : slots ) {
+      if ( slot.epoch_id == 0 || slot.epoch_id < expired_before ) return &slot;
+    }
+    return nullptr;
+  }
+
+  bool is_empty() const {
+    for ( const redemption_slot& slot : slots ) {
+      if ( slot.epoch_id != 0 ) return false;
+    }
+    return true;
+  }
+};
+using user_requests_table = eosio::multi_index<"userrequests"_n, user_requests>;
+
+
+/**
+ * Scoped by epoch ID
+ * 
+ * Every user with a pending request for the epoch, and how much they requested.
+ * Kept in line with `userrequests` by `save_requests`.
+ * 
+ * NOTE: This is not a full ledger of an epoch's `wax_to_refund`. Requests still
+ * in the legacy `rdmrequests` table only get a row once `get_requests` moves them,
+ * and legacy requests it drops never do. `clearexpired` removes rows for expired
+ * epochs without touching their `wax_to_refund`.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] epoch_requests {
+  eosio::name     wallet;
+  int64_t         wax_amount_requested;   // WAX, symbol is implied
+
+  uint64_t primary_key() const { return wallet.value; }
+};
+using epoch_requests_table = eosio::multi_index<"epochreqs"_n, epoch_requests>;
+
+
 struct [[eosio::table]] refund_request {
   eosio::name             owner;
   eosio::time_point_sec   request_time;
@@ -269,6 +391,8 @@ typedef eosio::multi_index< "refunds"_n, refund_request >      refunds_table;
 /**
 * total bytes for a row is 560, except for the initial row which was 896
 * scoped by epoch ID. contract pays ram and removes rows after epoch ends
+* 
+* Legacy, new rentals go into `rentals`. Existing rows are still erased by `unstakecpu`
 */
 
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] renters {
@@ -287,6 +411,25 @@ using renters_table = eosio::multi_index<"renters"_n, renters,
       >;
 
 
+/**
+* Replaces `renters`, scoped by epoch ID. contract pays ram and removes rows after epoch ends
+* 
+* The primary key is a hash of renter + rent_to_account (see `find_rental`),
+* so there are no secondary indexes. A row is 32 bytes plus the 108 bytes of
+* per row overhead, vs 560 bytes for a `renters` row.
+*/
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] rentals {
+  uint64_t      key;
+  eosio::name   renter;
+  eosio::name   rent_to_account;
+  int64_t       amount_staked;    // WAX, symbol is implied
+
+  uint64_t primary_key() const { return key; }
+};
+using rentals_table = eosio::multi_index<"rentals"_n, rentals>;
+
+
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] rewards {
   uint64_t        periodStart;
   uint64_t        periodFinish;
@@ -313,6 +456,11 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] rewards {
 using rewards_singleton = eosio::singleton<"rewards"_n, rewards>;
 
 
+/**
+ * Legacy staker rows. New rows are only ever created in `stakers2`,
+ * existing rows are moved over in pages by `migstakers`.
+ */
+
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] stakers {
   eosio::name     wallet;
   eosio::asset    swax_balance;
@@ -325,11 +473,40 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] stakers {
 using staker_table = eosio::multi_index< "stakers"_n, stakers >;
 
 
+/**
+ * Compact version of `stakers`
+ * 
+ * The symbols are implied (sWAX for `swax_balance`, WAX for 
+ * `claimable_wax`), so only the raw amounts are stored.
+ * `last_update` is in seconds, so 32 bits is plenty.
+ * 
+ * Serialized size is 44 bytes vs 64 bytes for a `stakers` row.
+ * `staker_struct` is still the in-memory view of both.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] stakers2 {
+  eosio::name     wallet;
+  int64_t         swax_balance;
+  int64_t         claimable_wax;
+  uint32_t        last_update;
+  uint128_t       userRewardPerTokenPaid;
+
+  uint64_t primary_key() const { return wallet.value; }
+};
+using staker_table_2 = eosio::multi_index< "stakers2"_n, stakers2 >;
+
+
+/**
+ * `version` is bumped whenever `block_producers` changes, so cpu.fusion and pol.fusion
+ * can skip `voteproducer` when they already voted for this list
+ */
+
 struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] top21 {
-  std::vector<eosio::name>    block_producers;
-  uint64_t                    last_update;
+  std::vector<eosio::name>          block_producers;
+  uint64_t                          last_update;
+  eosio::binary_extension<uint64_t> version;
 
-  EOSLIB_SERIALIZE(top21, (block_producers)(last_update))
+  EOSLIB_SERIALIZE(top21, (block_producers)(last_update)(version))
 };
 using top21_singleton = eosio::singleton<"top21"_n, top21>;
 
@@ -1,98 +1,53 @@
 #pragma once
 
-void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, std::string memo) {
+/**
+ * Handles WAX sent to this contract
+ * 
+ * NOTE: Only notifications from `eosio.token` reach this handler, so
+ * transfers of other tokens never instantiate the contract.
+ */
 
-    const name tkcontract = get_first_receiver();
+void fusion::receive_wax_transfer(name from, name to, eosio::asset quantity, std::string memo) {
 
     if ( quantity.amount == 0 || from == get_self() || to != get_self() ) return;
-    if ( tkcontract != WAX_CONTRACT && tkcontract != TOKEN_CONTRACT ) return;
 
     check( quantity.amount > 0, "must send a positive quantity" );
     check( quantity.amount < MAX_ASSET_AMOUNT, "quantity too large" );
-    check( is_lswax_or_wax( quantity.symbol, tkcontract ), "only WAX and lsWAX are accepted" );
+    check( is_lswax_or_wax( quantity.symbol, WAX_CONTRACT ), "only WAX and lsWAX are accepted" );
 
-    if ( !memo_is_expected( memo ) && from != "eosio"_n ) {
-        // if we reached here, the token is either wax or lswax, but the memo is not expected
-        // allow transfers from eosio with unexpected memos during testing
-        check( false, "must include a memo for transfers to dapp.fusion, see docs.waxfusion.io for a list of memos" );
-    }
-
-    if ( memo == "instant redeem" || memo == "rebalance" ) {
-
-        check( tkcontract == TOKEN_CONTRACT, "only LSWAX should be sent with this memo" );
-        check( from == POL_CONTRACT, ( "expected " + POL_CONTRACT.to_string() + " to be the sender" ).c_str() );
-
-        global  g = global_s.get();
-        rewards r = rewards_s.get();
-
-        sync_epoch( g );
-
-        check( quantity >= g.minimum_unliquify_amount, "minimum unliquify amount not met" );
-
-        auto            self_staker_itr = staker_t.require_find( _self.value, ERR_STAKER_NOT_FOUND );
-        staker_struct   self_staker     = staker_struct(*self_staker_itr);
-
-        extend_reward(g, r, self_staker);
-        update_reward(self_staker, r);      
-
-        int64_t swax_to_redeem = calculate_swax_output( quantity.amount, g );
-        check( g.wax_available_for_rentals.amount >= swax_to_redeem, "not enough instaredeem funds available" );
-
-        self_staker.swax_balance -= asset(swax_to_redeem, SWAX_SYMBOL);
-        modify_staker(self_staker);
-
-        r.totalSupply -= uint128_t(swax_to_redeem);
-
-        int64_t protocol_share  = calculate_asset_share( swax_to_redeem, g.protocol_fee_1e6 );
-        int64_t user_share      = swax_to_redeem - protocol_share;
-        check( safecast::add( protocol_share, user_share ) <= swax_to_redeem, "error calculating protocol fee" );
-
-        g.wax_available_for_rentals.amount      -= swax_to_redeem;
-        g.revenue_awaiting_distribution.amount  += protocol_share;
-        g.swax_currently_backing_lswax.amount   -= swax_to_redeem;
-        g.liquified_swax.amount                 -= quantity.amount;
-
-        global_s.set(g, _self);
-        rewards_s.set(r, _self);
-
-        retire_swax(swax_to_redeem);
-        retire_lswax(quantity.amount);
-
-        std::string transfer_memo = memo == "instant redeem" ? "for staking pool only" : "rebalance";
-        transfer_tokens( from, asset( user_share, WAX_SYMBOL ), WAX_CONTRACT, transfer_memo );
+    const memo::memo_words  words   = memo::memo_words( memo );
+    const MEMO_COMMAND      command = get_wax_memo_command( memo, words );
 
+    if ( command == MEMO_COMMAND::NONE ) {
+        reject_memo( from, get_lswax_memo_command( memo, words ) );
         return;
     }
 
-    else if ( memo == "wax_lswax_liquidity" ) {
+    if ( command == MEMO_COMMAND::WAX_LSWAX_LIQUIDITY ) {
 
-        check( tkcontract == WAX_CONTRACT, "only WAX should be sent with this memo" );
-        check( from == POL_CONTRACT, ( "expected " + POL_CONTRACT.to_string() + " to be the sender" ).c_str() );
+        check( from == POL_CONTRACT, [&]{ return "expected " + POL_CONTRACT.to_string() + " to be the sender"; } );
 
-        global  g = global_s.get();
-        rewards r = rewards_s.get();
+        state&  s = state_s.modify();
+        rewards& r = rewards_s.modify();
 
-        sync_epoch( g );
+        sync_epoch( s );
 
-        auto            self_staker_itr = staker_t.require_find( _self.value, ERR_STAKER_NOT_FOUND );
-        staker_struct   self_staker     = staker_struct(*self_staker_itr);
+        staker_handle   self_staker     = get_staker(_self);
 
-        extend_reward(g, r, self_staker);
-        update_reward(self_staker, r);          
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(self_staker, r);
 
         self_staker.swax_balance += asset(quantity.amount, SWAX_SYMBOL);
-        modify_staker(self_staker); 
+        self_staker.save(); 
 
         r.totalSupply += uint128_t(quantity.amount);        
 
-        int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, g);
-
-        g.swax_currently_backing_lswax.amount   += quantity.amount;
-        g.liquified_swax.amount                 += converted_lsWAX_i64;
-        g.wax_available_for_rentals             += quantity;
+        int64_t converted_lsWAX_i64 = calculate_lswax_output(quantity.amount, s );
 
-        global_s.set(g, _self);
-        rewards_s.set(r, _self);
+        s.swax_currently_backing_lswax.amount   += quantity.amount;
+        s.liquified_swax.amount                 += converted_lsWAX_i64;
+        s.wax_available_for_rentals             += quantity;
 
         issue_swax(quantity.amount);
         issue_lswax(converted_lsWAX_i64, _self);
@@ -101,143 +56,118 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
         return;
     }
 
-    else if ( memo == "stake" ) {
-        check( tkcontract == WAX_CONTRACT, "only WAX is used for staking" );
+    else if ( command == MEMO_COMMAND::STAKE ) {
 
-        global g = global_s.get();
-        rewards r = rewards_s.get();
+        state&  s = state_s.modify();
+        const config& c = config_s.get();
+        rewards& r = rewards_s.modify();
 
-        sync_epoch( g );
+        sync_epoch( s );
 
-        check( quantity >= g.minimum_stake_amount, "minimum stake amount not met" );
+        check( quantity >= c.minimum_stake_amount, "minimum stake amount not met" );
 
         auto [staker, self_staker] = get_stakers(from);
 
-        extend_reward(g, r, self_staker);
-        update_reward(staker, r);
-        update_reward(self_staker, r);
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(staker, r);
+        settle_reward(self_staker, r);
 
         r.totalSupply += uint128_t(quantity.amount);
 
         staker.swax_balance.amount += quantity.amount;
-        modify_staker(staker);
-        modify_staker(self_staker);
+        staker.save();
+        self_staker.save();
 
-        g.swax_currently_earning.amount += quantity.amount;
-        g.wax_available_for_rentals     += quantity;
-        
-        rewards_s.set(r, _self);
-        global_s.set(g, _self);
+        s.swax_currently_earning.amount += quantity.amount;
+        s.wax_available_for_rentals     += quantity;
 
         issue_swax(quantity.amount);
 
         return;
     }
 
-    else if ( memo == "unliquify" ) {
-
-        global  g = global_s.get();
-        rewards r = rewards_s.get();
-
-        sync_epoch( g );
+    else if ( command == MEMO_COMMAND::WAXFUSION_REVENUE ) {
 
-        check( tkcontract == TOKEN_CONTRACT, "only LSWAX can be unliquified" );
-        check( quantity >= g.minimum_unliquify_amount, "minimum unliquify amount not met" );
+        state&  s = state_s.modify();
+        s.revenue_awaiting_distribution += quantity;
 
-        int64_t converted_sWAX_i64 = calculate_swax_output(quantity.amount, g);
+        return;
+    }
 
-        auto [staker, self_staker] = get_stakers(from);
+    else if ( command == MEMO_COMMAND::LP_INCENTIVES ) {
 
-        extend_reward(g, r, self_staker);
-        update_reward(staker, r);
-        update_reward(self_staker, r);
+        state&  s = state_s.modify();
+        rewards& r = rewards_s.modify();
 
-        staker.swax_balance         += asset(converted_sWAX_i64, SWAX_SYMBOL);
-        self_staker.swax_balance    -= asset(converted_sWAX_i64, SWAX_SYMBOL); 
+        sync_epoch( s );
 
-        modify_staker(staker);
-        modify_staker(self_staker);     
+        int64_t converted_lsWAX_i64 = calculate_lswax_output( quantity.amount, s );
 
-        g.liquified_swax                        -= quantity;
-        g.swax_currently_backing_lswax.amount   -= converted_sWAX_i64;
-        g.swax_currently_earning.amount         += converted_sWAX_i64;
-        
-        rewards_s.set(r, _self);
-        global_s.set(g, _self);
+        s.incentives_bucket.amount              += converted_lsWAX_i64;
+        s.wax_available_for_rentals             += quantity;
+        s.swax_currently_backing_lswax.amount   += quantity.amount;
+        s.liquified_swax.amount                 += converted_lsWAX_i64;
 
-        retire_lswax(quantity.amount);
+        staker_handle   self_staker     = get_staker(_self);
 
-        return;
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(self_staker, r);
 
-    }
+        issue_swax(quantity.amount);
+        issue_lswax(converted_lsWAX_i64, _self);
 
-    else if ( memo == "waxfusion_revenue" ) {
-        check( tkcontract == WAX_CONTRACT, "only WAX is accepted with waxfusion_revenue memo" );
+        self_staker.swax_balance += asset(quantity.amount, SWAX_SYMBOL);
+        self_staker.save();
 
-        global g = global_s.get();
-        g.revenue_awaiting_distribution += quantity;
-        global_s.set(g, _self);
+        r.totalSupply += uint128_t(quantity.amount);
 
         return;
     }
 
-    else if ( memo == "lp_incentives" ) {
-
-        global  g = global_s.get();
-        rewards r = rewards_s.get();
-
-        sync_epoch( g );
+    else if ( command == MEMO_COMMAND::CPU_RENTAL_RETURN ) {
 
-        if ( tkcontract == WAX_CONTRACT ) {
+        state&  s = state_s.modify();
+        const config& c = config_s.get();
 
-            int64_t converted_lsWAX_i64 = calculate_lswax_output( quantity.amount, g );
+        check( is_cpu_contract(c, from), "sender is not a valid cpu rental contract" );
 
-            issue_swax(quantity.amount);
-            issue_lswax(converted_lsWAX_i64, _self);
+        sync_epoch( s );
 
-            g.incentives_bucket.amount              += converted_lsWAX_i64;
-            g.wax_available_for_rentals             += quantity;
-            g.swax_currently_backing_lswax.amount   += quantity.amount;
-            g.liquified_swax.amount                 += converted_lsWAX_i64;
+        uint64_t    relevant_epoch  = s.last_epoch_start_time - s.cpu_rental_epoch_length_seconds;
+        auto        epoch_itr       = epochs_t.find(relevant_epoch);
 
-            auto            self_staker_itr = staker_t.require_find( _self.value, ERR_STAKER_NOT_FOUND );
-            staker_struct   self_staker     = staker_struct(*self_staker_itr);
+        bool epoch_was_pruned = false;
 
-            extend_reward(g, r, self_staker);
-            update_reward(self_staker, r);  
-
-            self_staker.swax_balance += asset(quantity.amount, SWAX_SYMBOL);
-            modify_staker(self_staker);
-
-            r.totalSupply += uint128_t(quantity.amount);            
+        if ( epoch_itr == epochs_t.end() ) {
+            epoch_was_pruned = epoch_archive_s.exists() && relevant_epoch <= epoch_archive_s.get().last_pruned_epoch;
+            check( epoch_was_pruned, "could not locate relevant epoch" );
+        } else {
+            // `pruneepochs` only leaves the epochs that are still in use, so this is at most a few rows
+            while ( epoch_itr->cpu_wallet != from && epoch_itr != epochs_t.begin() ) {
+                epoch_itr --;
+            }
 
-        } else if ( tkcontract == TOKEN_CONTRACT ) {
-            g.incentives_bucket += quantity;
+            if ( epoch_itr->cpu_wallet != from ) {
+                // The sender's epoch is older than every epoch still in the table,
+                // which is only expected if the epoch right before them was pruned
+                epoch_was_pruned =  epoch_archive_s.exists()
+                                    && epoch_itr->start_time <= epoch_archive_s.get().last_pruned_epoch + s.seconds_between_epochs;
+                check( epoch_was_pruned, "sender does not match wallet linked to epoch" );
+            }
         }
 
-        global_s.set(g, _self);
-        rewards_s.set(r, _self);
-        return;
-    }
-
-    else if ( memo == "cpu rental return" ) {
-
-        global g = global_s.get();
-
-        check( tkcontract == WAX_CONTRACT, "only WAX can be sent with this memo" );
-        check( is_cpu_contract(g, from), "sender is not a valid cpu rental contract" );
-
-        sync_epoch( g );
+        if ( epoch_was_pruned ) {
+            // These funds belong to an epoch that was already pruned. Its redemption
+            // period is over, so they go straight back to the rental pool
+            epoch_archive& a = epoch_archive_s.modify();
 
-        uint64_t    relevant_epoch  = g.last_epoch_start_time - g.cpu_rental_epoch_length_seconds;
-        auto        epoch_itr       = epochs_t.require_find(relevant_epoch, "could not locate relevant epoch");
-
-        while ( epoch_itr->cpu_wallet != from && epoch_itr != epochs_t.begin() ) {
-            epoch_itr --;
+            a.total_cpu_funds_returned  += quantity;
+            s.wax_available_for_rentals += quantity;
+            return;
         }
 
-        check( epoch_itr->cpu_wallet == from, "sender does not match wallet linked to epoch" );
-
         asset total_added_to_redemption_bucket  = epoch_itr->total_added_to_redemption_bucket;
         asset amount_to_send_to_rental_bucket   = quantity;
 
@@ -254,11 +184,11 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
 
             total_added_to_redemption_bucket.amount +=  amount_added;
             amount_to_send_to_rental_bucket.amount  -=  amount_added;
-            g.wax_for_redemption.amount             +=  amount_added;
+            s.wax_for_redemption.amount             +=  amount_added;
         }
 
         if (amount_to_send_to_rental_bucket.amount > 0) {
-            g.wax_available_for_rentals += amount_to_send_to_rental_bucket;
+            s.wax_available_for_rentals += amount_to_send_to_rental_bucket;
         }
 
         asset total_cpu_funds_returned  =   epoch_itr->total_cpu_funds_returned;
@@ -269,11 +199,182 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
             _e.total_added_to_redemption_bucket = total_added_to_redemption_bucket;
         });
 
-        global_s.set(g, _self);
         return;
     }
 
-    vector<string> words = get_words( memo );
+    else if ( command == MEMO_COMMAND::RENT_CPU ) {
+        check( words.size() >= 5, "memo for rent_cpu operation is incomplete" );
+
+        const name      cpu_receiver                    = name( words[2] );
+        const uint64_t  wax_amount_to_rent              = memo::to_uint64( words[3] );
+        const uint64_t  amount_to_rent_with_precision   = safecast::mul( wax_amount_to_rent, uint64_t(SCALE_FACTOR_1E8) );
+        const uint64_t  epoch_id_to_rent_from           = memo::to_uint64( words[4] );
+
+        check( is_account( cpu_receiver ), [&]{ return cpu_receiver.to_string() + " is not an account"; } );
+        check( wax_amount_to_rent >= MINIMUM_WAX_TO_RENT, [&]{ return "minimum wax amount to rent is " + std::to_string( MINIMUM_WAX_TO_RENT ); } );
+        check( wax_amount_to_rent <= MAXIMUM_WAX_TO_RENT, [&]{ return "maximum wax amount to rent is " + std::to_string( MAXIMUM_WAX_TO_RENT ); } );       
+
+        auto            epoch_itr   = require_find( epochs_t, epoch_id_to_rent_from, [&]{ return "epoch " + std::to_string(epoch_id_to_rent_from) + " does not exist"; } );
+        state&          s           = state_s.modify();
+        const config&   c           = config_s.get();
+
+        sync_epoch( s );
+
+        check( s.wax_available_for_rentals.amount >= amount_to_rent_with_precision, "there is not enough wax in the rental pool to cover this rental" );
+        s.wax_available_for_rentals.amount -= int64_t(amount_to_rent_with_precision);
+
+        uint64_t    seconds_to_rent             = get_seconds_to_rent_cpu(s, epoch_id_to_rent_from);
+        int64_t     expected_amount_received    = mulDiv( uint64_t(c.cost_to_rent_1_wax.amount) * wax_amount_to_rent, seconds_to_rent, uint128_t(days_to_seconds(1)) );
+
+        check( quantity.amount >= expected_amount_received, [&]{ return "expected to receive " + eosio::asset( expected_amount_received, WAX_SYMBOL ).to_string(); } );
+        
+        s.revenue_awaiting_distribution.amount += expected_amount_received;
+
+        if ( quantity.amount > expected_amount_received ) {
+            int64_t amount_to_refund = safecast::sub(quantity.amount, expected_amount_received);
+            transfer_tokens( from, asset( amount_to_refund, WAX_SYMBOL ), WAX_CONTRACT, "cpu rental refund from waxfusion.io - liquid staking protocol" );
+        }
+
+        transfer_tokens( epoch_itr->cpu_wallet, asset( (int64_t) amount_to_rent_with_precision, WAX_SYMBOL), WAX_CONTRACT, cpu_stake_memo(cpu_receiver, epoch_id_to_rent_from) );
+
+        epochs_t.modify(epoch_itr, get_self(), [&](auto & _e) {
+            _e.wax_bucket.amount += (int64_t) amount_to_rent_with_precision;
+        });
+
+        rentals_table   rentals_t   = rentals_table( _self, epoch_id_to_rent_from );
+        uint64_t        free_key    = 0;
+        auto            rental_itr  = find_rental( rentals_t, from, cpu_receiver, free_key );
+
+        if ( rental_itr == rentals_t.end() ) {
+            rentals_t.emplace(_self, [&](auto & _r) {
+              _r.key                = free_key;
+              _r.renter             = from;
+              _r.rent_to_account    = cpu_receiver;
+              _r.amount_staked      = int64_t(amount_to_rent_with_precision);
+            });
+        } else {
+            rentals_t.modify(rental_itr, _self, [&](auto & _r) {
+              _r.amount_staked += int64_t(amount_to_rent_with_precision);
+            });
+        }
+
+        return;
+    }
+
+}
+
+/**
+ * Handles LSWAX sent to this contract
+ * 
+ * NOTE: Only notifications from `token.fusion` reach this handler. SWAX can't
+ * be transferred, so LSWAX is the only token that arrives here.
+ */
+
+void fusion::receive_lswax_transfer(name from, name to, eosio::asset quantity, std::string memo) {
+
+    if ( quantity.amount == 0 || from == get_self() || to != get_self() ) return;
+
+    check( quantity.amount > 0, "must send a positive quantity" );
+    check( quantity.amount < MAX_ASSET_AMOUNT, "quantity too large" );
+    check( is_lswax_or_wax( quantity.symbol, TOKEN_CONTRACT ), "only WAX and lsWAX are accepted" );
+
+    const memo::memo_words  words   = memo::memo_words( memo );
+    const MEMO_COMMAND      command = get_lswax_memo_command( memo, words );
+
+    if ( command == MEMO_COMMAND::NONE ) {
+        reject_memo( from, get_wax_memo_command( memo, words ) );
+        return;
+    }
+
+    if ( command == MEMO_COMMAND::INSTANT_REDEEM || command == MEMO_COMMAND::REBALANCE ) {
+
+        check( from == POL_CONTRACT, [&]{ return "expected " + POL_CONTRACT.to_string() + " to be the sender"; } );
+
+        state&  s = state_s.modify();
+        const config& c = config_s.get();
+        rewards& r = rewards_s.modify();
+
+        sync_epoch( s );
+
+        check( quantity >= c.minimum_unliquify_amount, "minimum unliquify amount not met" );
+
+        staker_handle   self_staker     = get_staker(_self);
+
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(self_staker, r);
+
+        int64_t swax_to_redeem = calculate_swax_output( quantity.amount, s );
+        check( s.wax_available_for_rentals.amount >= swax_to_redeem, "not enough instaredeem funds available" );
+
+        self_staker.swax_balance -= asset(swax_to_redeem, SWAX_SYMBOL);
+        self_staker.save();
+
+        r.totalSupply -= uint128_t(swax_to_redeem);
+
+        int64_t protocol_share  = calculate_asset_share( swax_to_redeem, c.protocol_fee_1e6 );
+        int64_t user_share      = swax_to_redeem - protocol_share;
+        check( safecast::add( protocol_share, user_share ) <= swax_to_redeem, "error calculating protocol fee" );
+
+        s.wax_available_for_rentals.amount      -= swax_to_redeem;
+        s.revenue_awaiting_distribution.amount  += protocol_share;
+        s.swax_currently_backing_lswax.amount   -= swax_to_redeem;
+        s.liquified_swax.amount                 -= quantity.amount;
+
+        retire_swax(swax_to_redeem);
+        retire_lswax(quantity.amount);
+
+        std::string transfer_memo = command == MEMO_COMMAND::INSTANT_REDEEM ? "for staking pool only" : "rebalance";
+        transfer_tokens( from, asset( user_share, WAX_SYMBOL ), WAX_CONTRACT, transfer_memo );
+
+        return;
+    }
+
+    else if ( command == MEMO_COMMAND::UNLIQUIFY ) {
+
+        state&  s = state_s.modify();
+        const config& c = config_s.get();
+        rewards& r = rewards_s.modify();
+
+        sync_epoch( s );
+
+        check( quantity >= c.minimum_unliquify_amount, "minimum unliquify amount not met" );
+
+        int64_t converted_sWAX_i64 = calculate_swax_output(quantity.amount, s );
+
+        auto [staker, self_staker] = get_stakers(from);
+
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(staker, r);
+        settle_reward(self_staker, r);
+
+        staker.swax_balance         += asset(converted_sWAX_i64, SWAX_SYMBOL);
+        self_staker.swax_balance    -= asset(converted_sWAX_i64, SWAX_SYMBOL); 
+
+        staker.save();
+        self_staker.save();     
+
+        s.liquified_swax                        -= quantity;
+        s.swax_currently_backing_lswax.amount   -= converted_sWAX_i64;
+        s.swax_currently_earning.amount         += converted_sWAX_i64;
+
+        retire_lswax(quantity.amount);
+
+        return;
+
+    }
+
+    else if ( command == MEMO_COMMAND::LP_INCENTIVES ) {
+
+        state&  s = state_s.modify();
+
+        sync_epoch( s );
+
+        s.incentives_bucket += quantity;
+
+        return;
+    }
 
     /**
      * Used for creating an LP farm on Alcor
@@ -286,16 +387,16 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
      * 
      */
 
-    if( words [1] == "new_incentive" ){
-        global2         g2              = global_s_2.get();
-        const uint64_t  pool_id         = std::strtoull( words[2].c_str(), NULL, 0 );
-        const uint64_t  duration_days   = std::strtoull( words[3].c_str(), NULL, 0 );
+    if ( command == MEMO_COMMAND::NEW_INCENTIVE ){
+        const global2&  g2              = global_s_2.get();
+        const uint64_t  pool_id         = memo::to_uint64( words[2] );
+        const uint64_t  duration_days   = memo::to_uint64( words[3] );
         auto            alcor_itr       = pools_t.require_find( pool_id, "alcor pool id does not exist" );        
 
-        check( tkcontract == TOKEN_CONTRACT, "only LSWAX can be sent with this memo" );
         check( words.size() >= 4, "memo for new_incentive operation is incomplete" );
         check( duration_days >= 7 && duration_days <= 365, "duration must be between 7 and 365 days" );
-        check( quantity >= g2.minimum_new_incentive, ( "minimum incentive is " + g2.minimum_new_incentive.to_string() ).c_str() );
+        check( quantity >= g2.minimum_new_incentive, [&]{ return "minimum incentive is " + g2.minimum_new_incentive.to_string(); } );
+        check( farms_are_migrated(), "run migfarms first" );
 
         check(  (alcor_itr->tokenA.quantity.symbol == LSWAX_SYMBOL && alcor_itr->tokenA.contract == TOKEN_CONTRACT) 
                 ||
@@ -312,11 +413,11 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
          * to the ecosystem fund. `createfarms` action will distribute these funds later,
          * in this scenario.
          */
-        auto lpfarms_itr = lpfarms_t.find(pool_id);
-        if(lpfarms_itr != lpfarms_t.end()){
-            auto incent_id_itr = incent_ids_t.require_find(pool_id, "incentive_id for this pair is not known yet, try again soon");
-            incent_ids_t.modify(incent_id_itr, _self, [&](auto & _incent) {
-                _incent.pending_boosts += quantity;
+        auto farm_itr = farms_t.find(pool_id);
+        if(farm_itr != farms_t.end()){
+            check( farm_itr->incentive_id.has_value(), "incentive_id for this pair is not known yet, try again soon" );
+            farms_t.modify(farm_itr, _self, [&](auto & _farm) {
+                _farm.pending_boosts += quantity;
             });
             return;
         }
@@ -343,83 +444,22 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
         return;        
     }
 
-    if ( words[1] == "rent_cpu" ) {
-        check( tkcontract == WAX_CONTRACT, "only WAX can be sent with this memo" );
-        check( words.size() >= 5, "memo for rent_cpu operation is incomplete" );
-
-        const name      cpu_receiver                    = name( words[2] );
-        const uint64_t  wax_amount_to_rent              = std::strtoull( words[3].c_str(), NULL, 0 );
-        const uint64_t  amount_to_rent_with_precision   = safecast::mul( wax_amount_to_rent, uint64_t(SCALE_FACTOR_1E8) );
-        const uint64_t  epoch_id_to_rent_from           = std::strtoull( words[4].c_str(), NULL, 0 );
-
-        check( is_account( cpu_receiver ), ( cpu_receiver.to_string() + " is not an account" ).c_str() );
-        check( wax_amount_to_rent >= MINIMUM_WAX_TO_RENT, ( "minimum wax amount to rent is " + std::to_string( MINIMUM_WAX_TO_RENT ) ).c_str() );
-        check( wax_amount_to_rent <= MAXIMUM_WAX_TO_RENT, ( "maximum wax amount to rent is " + std::to_string( MAXIMUM_WAX_TO_RENT ) ).c_str() );       
-
-        auto    epoch_itr   = epochs_t.require_find( epoch_id_to_rent_from, ("epoch " + std::to_string(epoch_id_to_rent_from) + " does not exist").c_str() );
-        global  g           = global_s.get();
-
-        sync_epoch( g );
-
-        check( g.wax_available_for_rentals.amount >= amount_to_rent_with_precision, "there is not enough wax in the rental pool to cover this rental" );
-        g.wax_available_for_rentals.amount -= int64_t(amount_to_rent_with_precision);
-
-        uint64_t    seconds_to_rent             = get_seconds_to_rent_cpu(g, epoch_id_to_rent_from);
-        int64_t     expected_amount_received    = mulDiv( uint64_t(g.cost_to_rent_1_wax.amount) * wax_amount_to_rent, seconds_to_rent, uint128_t(days_to_seconds(1)) );
-
-        check( quantity.amount >= expected_amount_received, ( "expected to receive " + eosio::asset( expected_amount_received, WAX_SYMBOL ).to_string() ).c_str() );
-        
-        g.revenue_awaiting_distribution.amount += expected_amount_received;
-
-        if ( quantity.amount > expected_amount_received ) {
-            int64_t amount_to_refund = safecast::sub(quantity.amount, expected_amount_received);
-            transfer_tokens( from, asset( amount_to_refund, WAX_SYMBOL ), WAX_CONTRACT, "cpu rental refund from waxfusion.io - liquid staking protocol" );
-        }
-
-        transfer_tokens( epoch_itr->cpu_wallet, asset( (int64_t) amount_to_rent_with_precision, WAX_SYMBOL), WAX_CONTRACT, cpu_stake_memo(cpu_receiver, epoch_id_to_rent_from) );
-
-        epochs_t.modify(epoch_itr, get_self(), [&](auto & _e) {
-            _e.wax_bucket.amount += (int64_t) amount_to_rent_with_precision;
-        });
-
-        renters_table   renters_t               = renters_table( _self, epoch_id_to_rent_from );
-        auto            renter_receiver_idx     = renters_t.get_index<"fromtocombo"_n>();
-        const uint128_t renter_receiver_combo   = mix64to128(from.value, cpu_receiver.value);
-        auto            rental_itr              = renter_receiver_idx.find(renter_receiver_combo);
-
-        if ( rental_itr == renter_receiver_idx.end() ) {
-            renters_t.emplace(_self, [&](auto & _r) {
-              _r.ID                 = renters_t.available_primary_key();
-              _r.renter             = from;
-              _r.rent_to_account    = cpu_receiver;
-              _r.amount_staked      = asset( int64_t(amount_to_rent_with_precision), WAX_SYMBOL );
-            });
-        } else {
-            renter_receiver_idx.modify(rental_itr, _self, [&](auto & _r) {
-              _r.amount_staked.amount += int64_t(amount_to_rent_with_precision);
-            });
-        }
-
-        global_s.set(g, _self);
-        return;
-    }
-
-    else if ( words[1] == "unliquify_exact" ) {
+    else if ( command == MEMO_COMMAND::UNLIQUIFY_EXACT ) {
 
-        check( tkcontract == TOKEN_CONTRACT, "only LSWAX can be unliquified" );
         check( words.size() >= 3, "memo for unliquify_exact operation is incomplete" );
 
-        const uint64_t minimum_output = std::strtoull( words[2].c_str(), NULL, 0 );
+        const uint64_t minimum_output = memo::to_uint64( words[2] );
         check( minimum_output > 0 && minimum_output <= MAX_ASSET_AMOUNT_U64, "minimum_output is out of range" );
 
-        global  g = global_s.get();
-        rewards r = rewards_s.get();
+        state&  s = state_s.modify();
+        const config& c = config_s.get();
+        rewards& r = rewards_s.modify();
 
-        sync_epoch( g );
+        sync_epoch( s );
 
-        check( quantity >= g.minimum_unliquify_amount, "minimum unliquify amount not met" );
+        check( quantity >= c.minimum_unliquify_amount, "minimum unliquify amount not met" );
 
-        int64_t converted_sWAX_i64 = calculate_swax_output(quantity.amount, g);
+        int64_t converted_sWAX_i64 = calculate_swax_output(quantity.amount, s );
 
         if( converted_sWAX_i64 < int64_t(minimum_output) ){
             check( false, "output would be " + asset(converted_sWAX_i64, SWAX_SYMBOL).to_string() + " but expected " + asset(int64_t(minimum_output), SWAX_SYMBOL).to_string() );
@@ -427,22 +467,20 @@ void fusion::receive_token_transfer(name from, name to, eosio::asset quantity, s
 
         auto [staker, self_staker] = get_stakers(from);
 
-        extend_reward(g, r, self_staker);
-        update_reward(staker, r);
-        update_reward(self_staker, r);
+        extend_reward(s, r, self_staker);
+        advance_reward(r);
+        settle_reward(staker, r);
+        settle_reward(self_staker, r);
 
         staker.swax_balance         += asset(converted_sWAX_i64, SWAX_SYMBOL);
         self_staker.swax_balance    -= asset(converted_sWAX_i64, SWAX_SYMBOL);
 
-        modify_staker(staker);
-        modify_staker(self_staker);
+        staker.save();
+        self_staker.save();
 
-        g.liquified_swax                        -= quantity;
-        g.swax_currently_backing_lswax.amount   -= converted_sWAX_i64;
-        g.swax_currently_earning.amount         += converted_sWAX_i64;
-        
-        global_s.set(g, _self);
-        rewards_s.set(r, _self);
+        s.liquified_swax                        -= quantity;
+        s.swax_currently_backing_lswax.amount   -= converted_sWAX_i64;
+        s.swax_currently_earning.amount         += converted_sWAX_i64;
 
         retire_lswax( quantity.amount );
         return;
@@ -3,25 +3,27 @@
 /** 
  * extend_reward function, but without modifying any state
  * 
- * @param g - global singleton
+ * @param s - state singleton
  * @param r - rewards singleton
  * @param self_staker - staker_struct that stores data about sWAX backing lsWAX
  */
 
-void fusion::readonly_extend_reward(global& g, rewards& r, staker_struct& self_staker) {
+void fusion::readonly_extend_reward(state& s, rewards& r, staker_struct& self_staker) {
 
     if ( now() <= r.periodFinish ) return;
 
-    if ( g.revenue_awaiting_distribution.amount == 0 ) {
-        zero_distribution( g, r );
+    if ( s.revenue_awaiting_distribution.amount == 0 ) {
+        zero_distribution( r );
         return;
     }
 
-    int64_t amount_to_distribute    = readonly_max_reward(g, r);
-    int64_t user_alloc_i64          = calculate_asset_share( amount_to_distribute, g.user_share_1e6 );
-    int64_t pol_alloc_i64           = calculate_asset_share( amount_to_distribute, g.pol_share_1e6 );
-    int64_t eco_alloc_i64           = calculate_asset_share( amount_to_distribute, g.ecosystem_share_1e6 );
-    int64_t lswax_amount_to_issue   = calculate_lswax_output( eco_alloc_i64, g );
+    const config& c = config_s.get();
+
+    int64_t amount_to_distribute    = readonly_max_reward(s, c, r);
+    int64_t user_alloc_i64          = calculate_asset_share( amount_to_distribute, c.user_share_1e6 );
+    int64_t pol_alloc_i64           = calculate_asset_share( amount_to_distribute, c.pol_share_1e6 );
+    int64_t eco_alloc_i64           = calculate_asset_share( amount_to_distribute, c.ecosystem_share_1e6 );
+    int64_t lswax_amount_to_issue   = calculate_lswax_output( eco_alloc_i64, s );
 
     // If rounding resulted in any leftover waxtoshis, add them to the reward farm
     const int64_t   sum         = user_alloc_i64 + pol_alloc_i64 + eco_alloc_i64;
@@ -40,10 +42,11 @@ void fusion::readonly_extend_reward(global& g, rewards& r, staker_struct& self_s
 
     r.lastUpdateTime    =   nf.lastUpdateTime;
     r.periodFinish      =   nf.periodFinish;
-    r.rewardRate        =   mulDiv128( uint128_t(user_alloc_i64), SCALE_FACTOR_1E8, uint128_t(STAKING_FARM_DURATION) );
+    r.rewardRate        =   fixed_point::mul_div( uint64_t(user_alloc_i64), uint64_t(SCALE_FACTOR_1E8), uint128_t(STAKING_FARM_DURATION) );
     r.rewardPool        +=  asset(user_alloc_i64, WAX_SYMBOL);
 
-    update_reward(self_staker, r);
+    advance_reward(r);
+    settle_reward(self_staker, r);
 
     r.totalSupply               += uint128_t(eco_alloc_i64);
     self_staker.swax_balance    += asset(eco_alloc_i64, SWAX_SYMBOL);
@@ -55,39 +58,40 @@ void fusion::readonly_extend_reward(global& g, rewards& r, staker_struct& self_s
  * NOTE: The compiler didn't require a separate readonly function here,
  * but it's better practice to not risk undesired behavior.
  * 
- * @param g - the `global` singleton
+ * @param s - the `state` singleton
+ * @param c - the `config` singleton
  * @param r - the `rewards` singleton
  * 
  * @return `int64_t` - the amount of WAX to distribute
  */
 
-int64_t fusion::readonly_max_reward(global& g, rewards& r){
-    global2     g2                  = global_s_2.get();
-    uint64_t    adjusted_max_apr    = mulDiv( g2.max_staker_apr_1e6, uint64_t(SCALE_FACTOR_1E8), uint128_t(g.user_share_1e6) );
+int64_t fusion::readonly_max_reward(state& s, const config& c, rewards& r){
+    const global2&  g2                  = global_s_2.get();
+    uint64_t    adjusted_max_apr    = mulDiv( g2.max_staker_apr_1e6, uint64_t(SCALE_FACTOR_1E8), uint128_t(c.user_share_1e6) );
     int64_t     max_yearly_reward   = calculate_asset_share( r.totalSupply, adjusted_max_apr );
     int64_t     max_daily_reward    = safecast::div( max_yearly_reward, int64_t(365) );
 
-    return std::min( max_daily_reward, g.revenue_awaiting_distribution.amount );
+    return std::min( max_daily_reward, s.revenue_awaiting_distribution.amount );
 }
 
 /** 
  * sync_epoch function, but without modifying any state
  * 
- * @param g - global singleton
+ * @param s - state singleton
  */
 
-inline void fusion::readonly_sync_epoch(global& g) {
+inline void fusion::readonly_sync_epoch(state& s) {
 
-  uint64_t next_epoch_start_time = g.last_epoch_start_time + g.seconds_between_epochs;
+  uint64_t next_epoch_start_time = s.last_epoch_start_time + s.seconds_between_epochs;
 
-  while ( now() >= next_epoch_start_time ) {
+  if ( now() < next_epoch_start_time ) return;
 
-    name next_cpu_contract = get_next_cpu_contract( g );
+  const config&   c               = config_s.get();
+  const uint64_t  epochs_elapsed  = ( now() - s.last_epoch_start_time ) / s.seconds_between_epochs;
+  const size_t    cpu_index       = get_cpu_contract_index( s, c );
 
-    g.last_epoch_start_time =   next_epoch_start_time;
-    g.current_cpu_contract  =   next_cpu_contract;
-    next_epoch_start_time   +=  g.seconds_between_epochs;
-  }
+  s.last_epoch_start_time +=  s.seconds_between_epochs * epochs_elapsed;
+  s.current_cpu_contract  =   c.cpu_contracts[ ( cpu_index + epochs_elapsed ) % c.cpu_contracts.size() ];
 }
 
 /**
@@ -103,9 +107,9 @@ inline void fusion::readonly_sync_epoch(global& g) {
 [[eosio::action, eosio::read_only]] uint64_t fusion::showexpcpu(const uint64_t& epoch_id)
 {
 
-    global g = global_s.get();
+    const state& s = state_s.get();
 
-    uint64_t    epoch_to_check  = epoch_id == 0 ? g.last_epoch_start_time - g.seconds_between_epochs : epoch_id;
+    uint64_t    epoch_to_check  = epoch_id == 0 ? s.last_epoch_start_time - s.seconds_between_epochs : epoch_id;
     auto        epoch_itr       = epochs_t.find( epoch_to_check );
 
     if(epoch_itr == epochs_t.end()) return uint64_t(NOT_FOUND);
@@ -119,6 +123,24 @@ inline void fusion::readonly_sync_epoch(global& g) {
     return epoch_to_check;
 }
 
+/**
+ * Shows the ecosystem fund in the layout of the legacy `lpfarms` table, for
+ * anything that hasn't switched over to reading the `farms` table yet
+ * 
+ * @return vector<lpfarms> with one row per pool in the `farms` table
+ */
+
+[[eosio::action, eosio::read_only]] vector<lpfarms> fusion::showlpfarms()
+{
+    vector<lpfarms> rows {};
+
+    for (auto itr = farms_t.begin(); itr != farms_t.end(); itr++) {
+        rows.push_back( lpfarms{ itr->poolId, itr->symbol_to_incentivize, itr->contract_to_incentivize, itr->percent_share_1e6 } );
+    }
+
+    return rows;
+}
+
 /**
  * Allows front ends to see if there are any refunds to claim from system contract
  * 
@@ -127,9 +149,9 @@ inline void fusion::readonly_sync_epoch(global& g) {
 
 [[eosio::action, eosio::read_only]] bool fusion::showrefunds()
 {
-    global g = global_s.get();
+    const config& c = config_s.get();
 
-    for (name ctrct : g.cpu_contracts) {
+    for (name ctrct : c.cpu_contracts) {
         refunds_table   refunds_t   = refunds_table( SYSTEM_CONTRACT, ctrct.value );
         auto            refund_itr  = refunds_t.find( ctrct.value );
 
@@ -151,16 +173,17 @@ inline void fusion::readonly_sync_epoch(global& g) {
 
 [[eosio::action, eosio::read_only]] asset fusion::showreward(const name& user)
 {
-    global  g = global_s.get();
+    state   s = state_s.get();
     rewards r = rewards_s.get();
 
-    readonly_sync_epoch( g );
+    readonly_sync_epoch( s );
 
     auto [staker, self_staker] = get_stakers(user);
 
-    readonly_extend_reward(g, r, self_staker);
-    update_reward(staker, r);
-    update_reward(self_staker, r);
+    readonly_extend_reward(s, r, self_staker);
+    advance_reward(r);
+    settle_reward(staker, r);
+    settle_reward(self_staker, r);
 
     return staker.claimable_wax;
 }
@@ -173,10 +196,10 @@ inline void fusion::readonly_sync_epoch(global& g) {
 
 [[eosio::action, eosio::read_only]] vector<name> fusion::showvoterwds()
 {
-    global g = global_s.get();
+    const config& c = config_s.get();
     vector<eosio::name> contracts_with_rewards {};
 
-    for (name ctrct : g.cpu_contracts) {
+    for (name ctrct : c.cpu_contracts) {
         voters_ns::voters_table voters_t(SYSTEM_CONTRACT, SYSTEM_CONTRACT.value);
         auto itr = voters_t.find(ctrct.value);
 
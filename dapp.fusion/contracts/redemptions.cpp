@@ -1,6 +1,51 @@
 #pragma once
 
-void fusion::handle_available_request(global& g, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill){
+/**
+ * Loads all of a `user`'s redemption requests
+ * 
+ * NOTE: Requests made before `userrequests` existed are still in the legacy
+ * `rdmrequests` table (scoped by user). Those rows are moved into `userrequests`
+ * the first time they are loaded, so the caller needs `user`'s authorization
+ * since the new row is billed to them. Legacy rows for epochs whose redemption
+ * window has already passed are erased without being moved. If there are still
+ * more legacy rows than slots, only the newest ones are kept.
+ * 
+ * @param user - wallet address of the user
+ * 
+ * @return `user_requests` - the user's requests, all slots are empty if they have none
+ */
+
+user_requests fusion::get_requests(const name& user){
+
+    auto itr = requests_t.find( user.value );
+    if ( itr != requests_t.end() ) return *itr;
+
+    user_requests requests{};
+    requests.wallet = user;
+
+    requests_tbl    legacy_t    = requests_tbl(get_self(), user.value);
+    auto            legacy_itr  = legacy_t.begin();
+    size_t          count       = 0;
+
+    if ( legacy_itr == legacy_t.end() ) return requests;
+
+    // Anything older than the epoch currently being redeemed can't be claimed anymore
+    const state&    s               = state_s.get();
+    const uint64_t  expired_before  = s.last_epoch_start_time - s.cpu_rental_epoch_length_seconds;
+
+    while ( legacy_itr != legacy_t.end() ) {
+        if ( legacy_itr->epoch_id >= expired_before ) {
+            requests.slots[ count % REDEMPTION_SLOTS ] = redemption_slot{ legacy_itr->epoch_id, legacy_itr->wax_amount_requested.amount };
+            count ++;
+        }
+        legacy_itr = legacy_t.erase( legacy_itr );
+    }
+
+    if ( count > 0 ) save_requests( requests );
+    return requests;
+}
+
+void fusion::handle_available_request(state& s, user_requests& requests, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill){
     
     /** 
      * If there is currently a redemption window open, we need to check if
@@ -10,51 +55,53 @@ void fusion::handle_available_request(global& g, bool& request_can_be_filled, st
      * need to redeem
      */
 
-    requests_tbl    requests_t              = requests_tbl(get_self(), staker.wallet.value);
-    uint64_t        redemption_start_time   = g.last_epoch_start_time;
-    uint64_t        redemption_end_time     = g.last_epoch_start_time + g.redemption_period_length_seconds;
-    uint64_t        epoch_to_claim_from     = g.last_epoch_start_time - g.seconds_between_epochs;
+    uint64_t        redemption_start_time   = s.last_epoch_start_time;
+    uint64_t        redemption_end_time     = s.last_epoch_start_time + s.redemption_period_length_seconds;
+    uint64_t        epoch_to_claim_from     = s.last_epoch_start_time - s.seconds_between_epochs;
 
     if ( now() < redemption_end_time ) {
         // There is currently a redemption window open
         // If this user has a request in that window, handle it before proceeding
 
-        auto epoch_itr  = epochs_t.find( epoch_to_claim_from );
-        auto req_itr    = requests_t.find( epoch_to_claim_from );
+        auto                epoch_itr   = epochs_t.find( epoch_to_claim_from );
+        redemption_slot*    slot        = requests.find_slot( epoch_to_claim_from );
+
+        if ( epoch_itr != epochs_t.end() && slot != nullptr ) {
 
-        if ( epoch_itr != epochs_t.end() && req_itr != requests_t.end() ) {
+                asset amount_requested = asset( slot->wax_amount_requested, WAX_SYMBOL );
 
-                check( req_itr->wax_amount_requested.amount <= staker.swax_balance.amount, "you have a pending request > your swax balance" );
+                check( amount_requested.amount <= staker.swax_balance.amount, "you have a pending request > your swax balance" );
 
                 // Make sure the redemption pool >= the request amount.
                 // The only time this should ever fail is if the CPU contract has not returned the funds yet, which should never really
                 // be more than a 5-10 minute window on a given week
-                check( g.wax_for_redemption.amount >= req_itr->wax_amount_requested.amount, "redemption pool is < your pending request" );
+                check( s.wax_for_redemption.amount >= amount_requested.amount, "redemption pool is < your pending request" );
 
-                if ( req_itr->wax_amount_requested.amount >= remaining_amount_to_fill.amount ) {
+                if ( amount_requested.amount >= remaining_amount_to_fill.amount ) {
                     request_can_be_filled = true;
                 } else {
-                    remaining_amount_to_fill.amount -= req_itr->wax_amount_requested.amount;
+                    remaining_amount_to_fill.amount -= amount_requested.amount;
                 }
 
-                g.wax_for_redemption -= req_itr->wax_amount_requested;
+                s.wax_for_redemption -= amount_requested;
 
                 epochs_t.modify( epoch_itr, same_payer, [&](auto & _e) {
-                    _e.wax_to_refund -= req_itr->wax_amount_requested;
+                    _e.wax_to_refund -= amount_requested;
                 });
 
-                staker.swax_balance.amount -= req_itr->wax_amount_requested.amount;
+                staker.swax_balance.amount -= amount_requested.amount;
 
-                transfer_tokens( staker.wallet, req_itr->wax_amount_requested, WAX_CONTRACT, std::string("your redemption from waxfusion.io - liquid staking protocol") );
+                transfer_tokens( staker.wallet, amount_requested, WAX_CONTRACT, std::string("your redemption from waxfusion.io - liquid staking protocol") );
 
-                requests_t.erase( req_itr );
+                *slot = redemption_slot{};
         }
     }   
 }
 
-void fusion::handle_new_request(vector<uint64_t>& epochs_to_check, bool& request_can_be_filled, staker_struct& staker, asset& remaining_amount_to_fill){
+void fusion::handle_new_request(state& s, vector<uint64_t>& epochs_to_check, user_requests& requests, bool& request_can_be_filled, asset& remaining_amount_to_fill){
     
-    requests_tbl requests_t = requests_tbl(get_self(), staker.wallet.value);
+    // Anything older than the epoch currently being redeemed can't be claimed anymore
+    const uint64_t expired_before = s.last_epoch_start_time - s.cpu_rental_epoch_length_seconds;
 
     for (uint64_t ep : epochs_to_check) {
         auto epoch_itr = epochs_t.find(ep);
@@ -65,7 +112,10 @@ void fusion::handle_new_request(vector<uint64_t>& epochs_to_check, bool& request
 
                 // There are still funds available to redeem from this epoch
 
-                int64_t amount_available = safecast::sub(epoch_itr->wax_bucket.amount, epoch_itr->wax_to_refund.amount);
+                int64_t             amount_available    = safecast::sub(epoch_itr->wax_bucket.amount, epoch_itr->wax_to_refund.amount);
+                redemption_slot*    slot                = requests.free_slot(expired_before);
+
+                check( slot != nullptr, "no free redemption slots" );
 
                 if (amount_available >= remaining_amount_to_fill.amount) {
 
@@ -77,10 +127,7 @@ void fusion::handle_new_request(vector<uint64_t>& epochs_to_check, bool& request
                         _e.wax_to_refund = asset(updated_refunding_amount, WAX_SYMBOL);
                     });
 
-                    requests_t.emplace(staker.wallet, [&](auto & _r) {
-                        _r.epoch_id             = ep;
-                        _r.wax_amount_requested = asset(remaining_amount_to_fill.amount, WAX_SYMBOL);
-                    });
+                    *slot = redemption_slot{ ep, remaining_amount_to_fill.amount };
 
                 } else {
 
@@ -92,10 +139,7 @@ void fusion::handle_new_request(vector<uint64_t>& epochs_to_check, bool& request
                         _e.wax_to_refund = asset(updated_refunding_amount, WAX_SYMBOL);
                     });
 
-                    requests_t.emplace(staker.wallet, [&](auto & _r) {
-                        _r.epoch_id             = ep;
-                        _r.wax_amount_requested = asset(amount_available, WAX_SYMBOL);
-                    });
+                    *slot = redemption_slot{ ep, amount_available };
                 }
             }
 
@@ -105,25 +149,110 @@ void fusion::handle_new_request(vector<uint64_t>& epochs_to_check, bool& request
     }   
 }
 
-void fusion::remove_existing_requests(vector<uint64_t>& epochs_to_check, staker_struct& staker, const bool& accept_replacing_prev_requests){
-
-    requests_tbl requests_t = requests_tbl(get_self(), staker.wallet.value);
+void fusion::remove_existing_requests(vector<uint64_t>& epochs_to_check, user_requests& requests, const bool& accept_replacing_prev_requests){
 
     for (uint64_t ep : epochs_to_check) {
 
-        auto epoch_itr  = epochs_t.find(ep);
-        auto req_itr    = requests_t.find(ep);
+        auto                epoch_itr   = epochs_t.find(ep);
+        redemption_slot*    slot        = requests.find_slot(ep);
 
-        if ( epoch_itr != epochs_t.end() && req_itr != requests_t.end() ) {
+        if ( epoch_itr != epochs_t.end() && slot != nullptr ) {
 
             check(accept_replacing_prev_requests, "you have previous requests but passed 'false' to the accept_replacing_prev_requests param");
             
             epochs_t.modify(epoch_itr, get_self(), [&](auto & _e) {
-                _e.wax_to_refund -= req_itr->wax_amount_requested;
+                _e.wax_to_refund.amount -= slot->wax_amount_requested;
             });
 
-            requests_t.erase(req_itr);
+            *slot = redemption_slot{};
             
         }
     }   
-}
\ No newline at end of file
+}
+
+/**
+ * Writes a user's requests back to `userrequests`, and updates the
+ * `epochreqs` ledger for any epochs that changed
+ * 
+ * NOTE: The row is kept when all of its slots are empty, so users who
+ * redeem regularly aren't paying for a new row every week. It only gets
+ * erased by `clearexpired`, which also erases rows that are already empty.
+ * 
+ * @param requests - `user_requests` containing the updated slots
+ */
+
+void fusion::save_requests(const user_requests& requests){
+
+    auto itr = requests_t.find( requests.wallet.value );
+
+    update_epoch_requests( itr != requests_t.end() ? *itr : user_requests{}, requests );
+
+    if ( itr != requests_t.end() ) {
+        requests_t.modify(itr, same_payer, [&](auto & _r) {
+            _r.slots = requests.slots;
+        });
+    } else if ( !requests.is_empty() ) {
+        requests_t.emplace(requests.wallet, [&](auto & _r) {
+            _r.wallet   = requests.wallet;
+            _r.slots    = requests.slots;
+        });
+    }
+}
+
+/**
+ * Sets the amount `wallet` has requested from an epoch in the `epochreqs` ledger
+ * 
+ * NOTE: Passing 0 removes the user from the epoch. If the epoch was already
+ * pruned there is nothing to remove, so that is not an error.
+ * 
+ * @param epoch_id - the epoch the request is for
+ * @param wallet - the user who made the request
+ * @param amount - the new amount of WAX requested
+ */
+
+void fusion::set_epoch_request(const uint64_t& epoch_id, const name& wallet, const int64_t& amount){
+
+    epoch_requests_table    epoch_requests_t    = epoch_requests_table( _self, epoch_id );
+    auto                    itr                 = epoch_requests_t.find( wallet.value );
+
+    if ( amount == 0 ) {
+        if ( itr != epoch_requests_t.end() ) epoch_requests_t.erase( itr );
+        return;
+    }
+
+    if ( itr == epoch_requests_t.end() ) {
+        epoch_requests_t.emplace(wallet, [&](auto & _r) {
+            _r.wallet               = wallet;
+            _r.wax_amount_requested = amount;
+        });
+    } else {
+        epoch_requests_t.modify(itr, same_payer, [&](auto & _r) {
+            _r.wax_amount_requested = amount;
+        });
+    }
+}
+
+/**
+ * Applies the difference between a user's old and new request slots to the `epochreqs` ledger
+ * 
+ * @param previous - the user's slots as they are currently stored
+ * @param requests - the user's updated slots
+ */
+
+void fusion::update_epoch_requests(const user_requests& previous, const user_requests& requests){
+
+    for ( const redemption_slot& slot : previous.slots ) {
+        if ( slot.epoch_id == 0 ) continue;
+
+        const redemption_slot*  updated = requests.find_slot( slot.epoch_id );
+        int64_t                 amount  = updated == nullptr ? 0 : updated->wax_amount_requested;
+
+        if ( amount != slot.wax_amount_requested ) set_epoch_request( slot.epoch_id, requests.wallet, amount );
+    }
+
+    for ( const redemption_slot& slot : requests.slots ) {
+        if ( slot.epoch_id == 0 || previous.find_slot( slot.epoch_id ) != nullptr ) continue;
+
+        set_epoch_request( slot.epoch_id, requests.wallet, slot.wax_amount_requested );
+    }
+}
@@ -2,15 +2,10 @@
 
 // auto rounding down
 int64_t fusion::mulDiv(uint64_t a, uint64_t b, uint128_t denominator) {
-  uint128_t prod = safecast::mul(uint128_t(a), uint128_t(b));
-  uint128_t result = safecast::div(prod, denominator);
-
-  return safecast::safe_cast<int64_t>(result);
+  return safecast::safe_cast<int64_t>( fixed_point::mul_div(a, b, denominator) );
 }
 
+// full 128 bit operands, see `fixed_point::mul_div` for narrower ones
 uint128_t fusion::mulDiv128(const uint128_t& a, const uint128_t& b, const uint128_t& denominator) {
-  uint128_t prod = safecast::mul(a, b);
-  uint128_t result = safecast::div(prod, denominator);
-
-  return result;
+  return fixed_point::mul_div(a, b, denominator);
 }
\ No newline at end of file
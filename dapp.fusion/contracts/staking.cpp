@@ -1,30 +1,54 @@
 #pragma once
 
+/**
+ * Advances `rewardPerTokenStored` to the current time
+ * 
+ * NOTE: `now()` doesn't change during a transaction, so once this has run
+ * there is nothing left to accrue. Every later call in the same action returns
+ * early, unless `totalSupply` is 0, since `reward_per_token` resets the
+ * accumulator in that case and skipping it would change the result.
+ * 
+ * @param r - `rewards` singleton with the reward pool state
+ */
+
+void fusion::advance_reward(rewards& r) {
+
+    if( r.lastUpdateTime == now() && r.totalSupply > 0 ) return;
+
+    if( r.lastUpdateTime < r.periodFinish && now() > r.periodStart ){
+        r.rewardPerTokenStored = reward_per_token(r);
+    }
+
+    r.lastUpdateTime = now();
+}
+
 /**
  * Extends the reward period if the existing period has ended
  * 
  * NOTE: If there are no rewards to distribute, a 
  * `zero_distribution` will occur
  * 
- * @param g - global singleton
+ * @param s - state singleton
  * @param r - rewards singleton
  * @param self_staker - staker_struct that stakes the sWAX backing lsWAX
  */
 
-void fusion::extend_reward(global& g, rewards& r, staker_struct& self_staker) {
+void fusion::extend_reward(state& s, rewards& r, staker_struct& self_staker) {
 
     if ( now() <= r.periodFinish ) return;
 
-    if ( g.revenue_awaiting_distribution.amount == 0 ) {
-        zero_distribution( g, r );
+    if ( s.revenue_awaiting_distribution.amount == 0 ) {
+        zero_distribution( r );
         return;
     }
 
-    int64_t amount_to_distribute    = max_reward(g, r);
-    int64_t user_alloc_i64          = calculate_asset_share( amount_to_distribute, g.user_share_1e6 );
-    int64_t pol_alloc_i64           = calculate_asset_share( amount_to_distribute, g.pol_share_1e6 );
-    int64_t eco_alloc_i64           = calculate_asset_share( amount_to_distribute, g.ecosystem_share_1e6 );
-    int64_t lswax_amount_to_issue   = calculate_lswax_output( eco_alloc_i64, g );
+    const config& c = config_s.get();
+
+    int64_t amount_to_distribute    = max_reward(s, c, r);
+    int64_t user_alloc_i64          = calculate_asset_share( amount_to_distribute, c.user_share_1e6 );
+    int64_t pol_alloc_i64           = calculate_asset_share( amount_to_distribute, c.pol_share_1e6 );
+    int64_t eco_alloc_i64           = calculate_asset_share( amount_to_distribute, c.ecosystem_share_1e6 );
+    int64_t lswax_amount_to_issue   = calculate_lswax_output( eco_alloc_i64, s );
 
     // If rounding resulted in any leftover waxtoshis, add them to the reward farm
     const int64_t sum           = user_alloc_i64 + pol_alloc_i64 + eco_alloc_i64;
@@ -34,12 +58,15 @@ void fusion::extend_reward(global& g, rewards& r, staker_struct& self_staker) {
 
     validate_allocations( amount_to_distribute, {user_alloc_i64, pol_alloc_i64, eco_alloc_i64} );
 
-    g.total_revenue_distributed.amount      +=  amount_to_distribute;
-    g.wax_available_for_rentals.amount      +=  eco_alloc_i64;
-    g.revenue_awaiting_distribution.amount  -=  amount_to_distribute;
-    g.incentives_bucket.amount              +=  lswax_amount_to_issue;
-    g.swax_currently_backing_lswax.amount   +=  eco_alloc_i64;
-    g.liquified_swax.amount                 +=  lswax_amount_to_issue;
+    s.total_revenue_distributed.amount      +=  amount_to_distribute;
+    s.wax_available_for_rentals.amount      +=  eco_alloc_i64;
+    s.revenue_awaiting_distribution.amount  -=  amount_to_distribute;
+    s.incentives_bucket.amount              +=  lswax_amount_to_issue;
+    s.swax_currently_backing_lswax.amount   +=  eco_alloc_i64;
+    s.liquified_swax.amount                 +=  lswax_amount_to_issue;
+
+    // Sent before the issues are queued, since transfer_tokens flushes the token batch
+    transfer_tokens( POL_CONTRACT, asset(pol_alloc_i64, WAX_SYMBOL), WAX_CONTRACT, std::string("pol allocation from waxfusion distribution") );
 
     issue_lswax( lswax_amount_to_issue, _self );
     issue_swax( eco_alloc_i64 );
@@ -53,15 +80,14 @@ void fusion::extend_reward(global& g, rewards& r, staker_struct& self_staker) {
 
     r.lastUpdateTime    =   nf.lastUpdateTime;
     r.periodFinish      =   nf.periodFinish;
-    r.rewardRate        =   mulDiv128( uint128_t(user_alloc_i64), SCALE_FACTOR_1E8, uint128_t(STAKING_FARM_DURATION) );
+    r.rewardRate        =   fixed_point::mul_div( uint64_t(user_alloc_i64), uint64_t(SCALE_FACTOR_1E8), uint128_t(STAKING_FARM_DURATION) );
     r.rewardPool        +=  asset(user_alloc_i64, WAX_SYMBOL);
 
-    update_reward(self_staker, r);
+    advance_reward(r);
+    settle_reward(self_staker, r);
 
     r.totalSupply               += uint128_t(eco_alloc_i64);
     self_staker.swax_balance    += asset(eco_alloc_i64, SWAX_SYMBOL);
-
-    transfer_tokens( POL_CONTRACT, asset(pol_alloc_i64, WAX_SYMBOL), WAX_CONTRACT, std::string("pol allocation from waxfusion distribution") );
 }
 
 /**
@@ -75,27 +101,54 @@ void fusion::extend_reward(global& g, rewards& r, staker_struct& self_staker) {
 
 int64_t fusion::earned(staker_struct& staker, rewards& r) {
 
-    uint128_t amount_to_add = mulDiv128( uint128_t(staker.swax_balance.amount),
-                                         ( r.rewardPerTokenStored - staker.userRewardPerTokenPaid ),
-                                         SCALE_FACTOR_1E16
-                                       );
+    uint128_t amount_to_add = fixed_point::mul_div( ( r.rewardPerTokenStored - staker.userRewardPerTokenPaid ),
+                                                    uint64_t(staker.swax_balance.amount),
+                                                    SCALE_FACTOR_1E16
+                                                  );
 
     return safecast::safe_cast<int64_t>(amount_to_add);
 }
 
+/**
+ * Looks up a staker in `stakers2`, falling back to the legacy
+ * `stakers` table for rows that haven't been migrated yet
+ * 
+ * @param user - the wallet address of the staker
+ * 
+ * @return `staker_handle` - check `exists()` before assuming the user has a row
+ */
+
+staker_handle fusion::find_staker(const name& user) {
+    return staker_handle(staker_t_2, staker_t, user);
+}
+
+/**
+ * Fetches data for a staker
+ * 
+ * Throws if the user has no row in either staker table
+ * 
+ * @param user - the wallet address of the staker
+ * 
+ * @return `staker_handle` - the user's data
+ */
+
+staker_handle fusion::get_staker(const name& user) {
+    staker_handle staker = find_staker(user);
+    check( staker.exists(), ERR_STAKER_NOT_FOUND );
+    return staker;
+}
+
 /**
  * Fetches data for a staker, and `self_staker`
  * 
  * @param user - the wallet address of the staker
  * 
- * @return `pair` - staker_struct for the user, and self_staker
+ * @return `pair` - staker_handle for the user, and self_staker
  */
 
-std::pair<staker_struct, staker_struct> fusion::get_stakers(const name& user) {
-    auto            staker_itr      = staker_t.require_find(user.value, ERR_STAKER_NOT_FOUND);
-    auto            self_staker_itr = staker_t.require_find(_self.value, ERR_STAKER_NOT_FOUND);
-    staker_struct   staker          = staker_struct(*staker_itr);
-    staker_struct   self_staker     = staker_struct(*self_staker_itr);
+std::pair<staker_handle, staker_handle> fusion::get_stakers(const name& user) {
+    staker_handle   staker          = get_staker(user);
+    staker_handle   self_staker     = get_staker(_self);
     return std::make_pair(staker, self_staker);
 }
 
@@ -111,35 +164,20 @@ std::pair<staker_struct, staker_struct> fusion::get_stakers(const name& user) {
  * 85% of rewards (depending on the global state). This is the reason that mulDiv 
  * is called when calculating `adjusted_max_apr`.
  * 
- * @param g - the `global` singleton
+ * @param s - the `state` singleton
+ * @param c - the `config` singleton
  * @param r - the `rewards` singleton
  * 
  * @return `int64_t` - the amount of WAX to distribute
  */
 
-int64_t fusion::max_reward(global& g, rewards& r){
-    global2     g2                  = global_s_2.get_or_create( _self, global2{} );
-    uint64_t    adjusted_max_apr    = mulDiv( g2.max_staker_apr_1e6, uint64_t(SCALE_FACTOR_1E8), uint128_t(g.user_share_1e6) );
+int64_t fusion::max_reward(state& s, const config& c, rewards& r){
+    const global2&  g2                  = global_s_2.get_or_create( _self, global2{} );
+    uint64_t    adjusted_max_apr    = mulDiv( g2.max_staker_apr_1e6, uint64_t(SCALE_FACTOR_1E8), uint128_t(c.user_share_1e6) );
     int64_t     max_yearly_reward   = calculate_asset_share( r.totalSupply, adjusted_max_apr );
     int64_t     max_daily_reward    = safecast::div( max_yearly_reward, int64_t(365) );
 
-    return std::min( max_daily_reward, g.revenue_awaiting_distribution.amount );
-}
-
-/**
- * Modifies an existing table row for a `staker`
- * 
- * @param staker - `staker_struct` containing the new data for the user
- */
-
-void fusion::modify_staker(staker_struct& staker){
-    auto itr = staker_t.require_find(staker.wallet.value, ERR_STAKER_NOT_FOUND);
-    staker_t.modify(itr, same_payer, [&](auto &_s){
-        _s.claimable_wax            = staker.claimable_wax;
-        _s.swax_balance             = staker.swax_balance;
-        _s.last_update              = staker.last_update;
-        _s.userRewardPerTokenPaid   = staker.userRewardPerTokenPaid;
-    });
+    return std::min( max_daily_reward, s.revenue_awaiting_distribution.amount );
 }
 
 /**
@@ -156,17 +194,17 @@ uint128_t fusion::reward_per_token(rewards& r)
     
     uint64_t    time_elapsed    = std::min( now(), r.periodFinish ) - std::max( r.periodStart, r.lastUpdateTime ) ;
     uint128_t   a               = r.rewardRate;
-    uint128_t   b               = uint128_t(time_elapsed) * SCALE_FACTOR_1E8;
+    uint64_t    b               = safecast::mul( time_elapsed, uint64_t(SCALE_FACTOR_1E8) );
     uint128_t   c               = r.totalSupply;
 
-    return r.rewardPerTokenStored + mulDiv128( a, b, c );
+    return r.rewardPerTokenStored + fixed_point::mul_div( a, b, c );
 }
 
 /**
- * Updates the current rewards for a `staker`
+ * Settles the current rewards for a `staker`
  * 
- * NOTE: This also updates the reward pool itself (if needed)
- * before updating the `staker`, as not doing so would result
+ * NOTE: `advance_reward` must be called first in the same action,
+ * as settling against a stale `rewardPerTokenStored` would result
  * in miscalculation of the user's rewards (and potentially
  * overallocation of the reward pool)
  * 
@@ -176,17 +214,13 @@ uint128_t fusion::reward_per_token(rewards& r)
  * @param r - `rewards` singleton with the reward pool state
  */
 
-void fusion::update_reward(staker_struct& staker, rewards& r) {
-        
-    if( r.lastUpdateTime < r.periodFinish && now() > r.periodStart ){
-        r.rewardPerTokenStored = reward_per_token(r);
-    }
+void fusion::settle_reward(staker_struct& staker, rewards& r) {
 
-    r.lastUpdateTime = now();
+    int64_t pending_rewards = 0;
 
     if( staker.swax_balance.amount > 0 && now() > r.periodStart ){
 
-        int64_t pending_rewards         =   earned(staker, r);
+        pending_rewards                 =   earned(staker, r);
         staker.claimable_wax.amount     +=  pending_rewards;
         r.totalRewardsPaidOut.amount    +=  pending_rewards;
 
@@ -194,6 +228,10 @@ void fusion::update_reward(staker_struct& staker, rewards& r) {
 
     }
 
+    // Only touch last_update if something was actually settled, otherwise
+    // an unchanged staker would still need a row write in `staker_handle::save`
+    if( pending_rewards == 0 && staker.userRewardPerTokenPaid == r.rewardPerTokenStored ) return;
+
     staker.userRewardPerTokenPaid   = r.rewardPerTokenStored;
     staker.last_update              = now();
 }
@@ -201,11 +239,10 @@ void fusion::update_reward(staker_struct& staker, rewards& r) {
 /**
  * If there are no rewards to distribute, extends the farm with 0 as `rewardRate`
  * 
- * @param g - `global` singleton
  * @param r - `rewards` singleton
  */
 
-void fusion::zero_distribution(global& g, rewards& r) {
+void fusion::zero_distribution(rewards& r) {
     if( r.lastUpdateTime < r.periodFinish ){
         r.rewardPerTokenStored  = reward_per_token(r);
         r.lastUpdateTime        = r.periodFinish;
@@ -1,6 +1,6 @@
 const { blockchain, contracts, incrementTime, init, initial_state, setTime, stake, simulate_days, unliquify } = require("./setup.spec.ts")
 const { getPayouts } = require('./notifications.spec.ts')
-const { almost_equal, calculate_wax_and_lswax_outputs, lswax, max_reward, rent_cpu_memo, swax, wax } = require("./helpers.ts")
+const { almost_equal, calculate_wax_and_lswax_outputs, lswax, max_reward, rent_cpu_memo, staker_view, swax, wax } = require("./helpers.ts")
 const { nameToBigInt, TimePoint, expectToThrow } = require("@eosnetwork/vert");
 const { Asset, Int64, Name, UInt64, UInt128, TimePointSec } = require('@wharfkit/antelope');
 const { assert } = require("chai");
@@ -53,7 +53,7 @@ const getAlcorIncentives = async (log = false) => {
 
 const getDappIncentives = async (log = false) => {
     const incentives = await contracts.dapp_contract.tables
-        .lpfarms(scopes.dapp)
+        .farms(scopes.dapp)
         .getTableRows()
     if(log){
         console.log("dapp incentives:")
@@ -75,9 +75,13 @@ const getBalances = async (user, contract, log = false) => {
 }
 
 const getDappGlobal = async (log = false) => {
-    const g = await contracts.dapp_contract.tables
-        .global(scopes.dapp)
+    const s = await contracts.dapp_contract.tables
+        .state(scopes.dapp)
         .getTableRows()[0]
+    const c = await contracts.dapp_contract.tables
+        .config(scopes.dapp)
+        .getTableRows()[0]
+    const g = { ...c, ...s }
     if(log){
         console.log('global:')
         console.log(g)  
@@ -142,9 +146,15 @@ const getPolState = async (log = false) => {
 }
 
 const getRedemptionRequests = async (user, log = false) => {
-    const requests = await contracts.dapp_contract.tables
-        .rdmrequests(Name.from(user).value.value)
-        .getTableRows()
+    const row = await contracts.dapp_contract.tables
+        .userrequests(scopes.dapp)
+        .getTableRows(Name.from(user).value.value)[0]
+    const requests = !row ? [] : row.slots
+        .filter(slot => Number(slot.epoch_id) != 0)
+        .map(slot => ({
+            epoch_id: slot.epoch_id,
+            wax_amount_requested: Asset.fromUnits(slot.wax_amount_requested, '8,WAX').toString()
+        }))
     if(log){
         console.log(`${user}'s requests:`)
         console.log(requests)
@@ -197,10 +207,22 @@ const getSupply = async (account, token, log = false) => {
     return row;
 }
 
+/* `ops` of every token.fusion `batch` action in the last transaction */
+const getTokenBatches = (log = false) => {
+    const batches = blockchain.actionTraces
+        .filter(t => t.receiver.toString() == 'token.fusion' && t.action.toString() == 'batch')
+        .map(t => t.decodedData.ops)
+    if(log){
+        console.log('token.fusion batches:')
+        console.log(batches)
+    }
+    return batches;
+}
+
 const getSWaxStaker = async (user, log = false) => {
-    const staker = await contracts.dapp_contract.tables
-        .stakers(scopes.dapp)
-        .getTableRows(Name.from(user).value.value)[0]
+    const staker = staker_view(await contracts.dapp_contract.tables
+        .stakers2(scopes.dapp)
+        .getTableRows(Name.from(user).value.value)[0])
     if(log){
         console.log(`${user}'s SWAX:`)
         console.log(staker)
@@ -209,9 +231,9 @@ const getSWaxStaker = async (user, log = false) => {
 }
 
 const getAllStakers = async (log = false) => {
-    const staker = await contracts.dapp_contract.tables
-        .stakers(scopes.dapp)
-        .getTableRows()
+    const staker = (await contracts.dapp_contract.tables
+        .stakers2(scopes.dapp)
+        .getTableRows()).map(staker_view)
     if(log){
         console.log(`all swax holders:`)
         console.log(staker)
@@ -240,6 +262,17 @@ const getVoters = async (log = false) => {
     return voters; 
 }
 
+const getCpuState = async (cpu_contract, log = false) => {
+    const state = await contracts[cpu_contract].tables
+        .state(nameToBigInt(`${cpu_contract}.fusion`))
+        .getTableRows()[0]
+    if(log){
+        console.log(`${cpu_contract} state:`)
+        console.log(state)
+    }
+    return state 
+}
+
 const getDelBw = async (account, log = false) => {
     const delbw = await contracts.system_contract.tables
         .delband(Name.from(account).value.value)
@@ -820,6 +853,68 @@ describe('\n\nclaimrewards action', () => {
         
         const vote_rewards = await getVoters()
     });  
+
+     it('success: two claims in the same block match the original reward math', async () => {
+        const start_time = 1710482400
+        await setTime(start_time)
+        await stake('bob', 1000)
+        await stake('mike', 500)
+        await incrementTime(600)
+        const now = BigInt(start_time + 600)
+
+        const rawStaker = (user) => contracts.dapp_contract.tables
+            .stakers2(scopes.dapp)
+            .getTableRows(Name.from(user).value.value)[0]
+        const waxUnits = async (user) => {
+            const rows = await getBalances(user, contracts.wax_contract)
+            return rows.length == 0 ? 0n : BigInt(Asset.from(rows[0].balance).units.toString())
+        }
+
+        // rewardPerTokenStored / earned exactly as update_reward computed them
+        // before it was split into advance_reward and settle_reward
+        const rewardPerToken = (r) => {
+            const stored = BigInt(r.rewardPerTokenStored)
+            const last_update = BigInt(r.lastUpdateTime)
+            const period_start = BigInt(r.periodStart)
+            const period_finish = BigInt(r.periodFinish)
+            if ( !(last_update < period_finish && now > period_start) ) return stored
+            if ( BigInt(r.totalSupply) == 0n ) return 0n
+            const elapsed = (now < period_finish ? now : period_finish) - (period_start > last_update ? period_start : last_update)
+            return stored + BigInt(r.rewardRate) * elapsed * 100000000n / BigInt(r.totalSupply)
+        }
+        const earned = (staker, reward_per_token) =>
+            BigInt(staker.swax_balance) > 0n ? (reward_per_token - BigInt(staker.userRewardPerTokenPaid)) * BigInt(staker.swax_balance) / 10000000000000000n : 0n
+
+        const rewards_before = await getRewardFarm()
+        const bob_before = rawStaker('bob')
+        const mike_before = rawStaker('mike')
+        const self_before = rawStaker('dapp.fusion')
+        const bob_wax_before = await waxUnits('bob')
+        const mike_wax_before = await waxUnits('mike')
+
+        await contracts.dapp_contract.actions.claimrewards(['bob']).send('bob@active');
+        await contracts.dapp_contract.actions.claimrewards(['mike']).send('mike@active');
+
+        const expected_rpt = rewardPerToken(rewards_before)
+        const bob_earned = earned(bob_before, expected_rpt) + BigInt(bob_before.claimable_wax)
+        const mike_earned = earned(mike_before, expected_rpt) + BigInt(mike_before.claimable_wax)
+        const self_earned = earned(self_before, expected_rpt)
+
+        const rewards_after = await getRewardFarm()
+        assert( BigInt(rewards_after.rewardPerTokenStored) == expected_rpt, "rewardPerTokenStored does not match the original math" )
+        assert( BigInt(rewards_after.lastUpdateTime) == now, "lastUpdateTime should be the current block time" )
+        assert( await waxUnits('bob') - bob_wax_before == bob_earned, "bob's claim does not match the original math" )
+        assert( await waxUnits('mike') - mike_wax_before == mike_earned, "mike's claim in the same block does not match the original math" )
+
+        const expected_paid_out = BigInt(Asset.from(rewards_before.totalRewardsPaidOut).units.toString())
+            + earned(bob_before, expected_rpt) + earned(mike_before, expected_rpt) + self_earned
+        assert( BigInt(Asset.from(rewards_after.totalRewardsPaidOut).units.toString()) == expected_paid_out, "totalRewardsPaidOut does not match the original math" )
+
+        // the second claim settles self_staker again without anything new to add
+        const self_after = rawStaker('dapp.fusion')
+        assert( BigInt(self_after.userRewardPerTokenPaid) == expected_rpt, "self_staker should be settled at the new rewardPerTokenStored" )
+        assert( BigInt(self_after.claimable_wax) == BigInt(self_before.claimable_wax) + self_earned, "self_staker should only be credited once" )
+    });  
      
 });
 
@@ -841,6 +936,47 @@ describe('\n\nclearexpired action', () => {
         await incrementTime(60*60*24*10)
         await contracts.dapp_contract.actions.clearexpired(['mike']).send('mike@active');
     });        
+
+    it('success: legacy requests are migrated without the expired ones', async () => {
+        const legacy_table = contracts.dapp_contract.tables.rdmrequests(nameToBigInt('mike'))
+        const expired_epoch = initial_state.chain_time - (86400*21)
+        const live_epoch = initial_state.chain_time
+        legacy_table.set(BigInt(expired_epoch), 'mike', { epoch_id: expired_epoch, wax_amount_requested: wax(3) })
+        legacy_table.set(BigInt(live_epoch), 'mike', { epoch_id: live_epoch, wax_amount_requested: wax(5) })
+
+        await contracts.dapp_contract.actions.clearexpired(['mike']).send('mike@active');
+
+        const requests = await getRedemptionRequests('mike')
+        assert( requests.length == 1, "only the live legacy request should be migrated" )
+        assert( Number(requests[0].epoch_id) == live_epoch, "migrated request should be for the live epoch" )
+        assert( requests[0].wax_amount_requested == wax(5), "migrated request should be for 5 wax" )
+        assert( legacy_table.getTableRows().length == 0, "legacy rows should all be erased" )
+    });
+
+    it('success: only expired legacy requests are erased', async () => {
+        const legacy_table = contracts.dapp_contract.tables.rdmrequests(nameToBigInt('mike'))
+        const expired_epoch = initial_state.chain_time - (86400*21)
+        legacy_table.set(BigInt(expired_epoch), 'mike', { epoch_id: expired_epoch, wax_amount_requested: wax(3) })
+
+        await contracts.dapp_contract.actions.clearexpired(['mike']).send('mike@active');
+
+        assert( legacy_table.getTableRows().length == 0, "expired legacy rows should be erased" )
+        const requests = await getRedemptionRequests('mike')
+        assert( requests.length == 0, "nothing should be migrated" )
+        const row = contracts.dapp_contract.tables.userrequests(scopes.dapp).getTableRows(nameToBigInt('mike'))[0]
+        assert( !row, "no userrequests row should be created" )
+    });
+
+    it('success: an empty userrequests row is erased', async () => {
+        const requests_table = contracts.dapp_contract.tables.userrequests(scopes.dapp)
+        const empty_slot = { epoch_id: 0, wax_amount_requested: 0 }
+        requests_table.set(nameToBigInt('mike'), 'mike', { wallet: 'mike', slots: [empty_slot, empty_slot, empty_slot, empty_slot] })
+
+        await contracts.dapp_contract.actions.clearexpired(['mike']).send('mike@active');
+
+        const row = requests_table.getTableRows(nameToBigInt('mike'))[0]
+        assert( !row, "the empty row should be erased" )
+    });
 });
 
 
@@ -863,6 +999,21 @@ describe('\n\ncreatefarms action', () => {
         await expectToThrow(action, "eosio_assert: hasn't been 1 week since last farms were created");
     });  
 
+    it('error: run migfarms first', async () => {
+        const legacy_table = contracts.dapp_contract.tables.lpfarms(scopes.dapp)
+        legacy_table.set(BigInt(3), 'dapp.fusion', { poolId: 3, symbol_to_incentivize: '4,HONEY', contract_to_incentivize: 'nfthivehoney', percent_share_1e6: 1000000 })
+        await simulate_days(7, true)
+        const action = contracts.dapp_contract.actions.createfarms([]).send('mike@active');
+        await expectToThrow(action, "eosio_assert: run migfarms first")
+        const setincentive = contracts.dapp_contract.actions.setincentive(['dapp.fusion', 3, '4,HONEY', 'nfthivehoney', 2000000]).send('dapp.fusion@active');
+        await expectToThrow(setincentive, "eosio_assert: run migfarms first")
+
+        await contracts.dapp_contract.actions.migfarms([]).send('dapp.fusion@active');
+        await contracts.dapp_contract.actions.createfarms([]).send('mike@active');
+        const alcor_incentives = await getAlcorIncentives()
+        assert( alcor_incentives.length == 2, "the migrated farm should get an incentive on alcor" )
+    });
+
     it('success with 2 farms', async () => {
         await contracts.dapp_contract.actions.setincentive(['dapp.fusion', 3, '4,HONEY', 'nfthivehoney', 1000000]).send('dapp.fusion@active');
         const incentives_after = await getDappIncentives()
@@ -946,6 +1097,23 @@ describe('\n\ninstaredeem action', () => {
         await contracts.dapp_contract.actions.instaredeem(['mike', swax(10)]).send('mike@active');
         const bal_after = await getSWaxStaker('mike')
         assert(bal_after.swax_balance == swax(0), "expected 0 swax after")
+    });
+
+     it('success: sWAX is retired before the WAX is transferred', async () => {
+        await stake('mike', 10)
+        const swax_supply_before = await getSupply(contracts.token_contract, 'SWAX')
+        await contracts.dapp_contract.actions.instaredeem(['mike', swax(10)]).send('mike@active');
+        const swax_supply_after = await getSupply(contracts.token_contract, 'SWAX')
+
+        const batches = getTokenBatches()
+        assert( batches.length == 1, "expected a single batch action" )
+        assert( batches[0].every(o => o.op.toString() == 'retire' && o.memo.length > 0), "expected only retire operations with memos" )
+        assert( parseFloat(swax_supply_after.supply) < parseFloat(swax_supply_before.supply), "expected sWAX supply to go down" )
+
+        const actions = blockchain.actionTraces.map(t => `${t.receiver}::${t.action}`)
+        const batch_index = actions.indexOf('token.fusion::batch')
+        const transfer_index = actions.indexOf('eosio.token::transfer')
+        assert( batch_index >= 0 && batch_index < transfer_index, "expected the batch to run before the WAX transfer" )
     });     
 });
 
@@ -988,6 +1156,35 @@ describe('\n\nliquify action', () => {
         assert(bal_after[0].balance == lswax(10), "expected balance after to be 10 lsWAX")        
     });    
 
+    it('success: lsWAX is issued in one batch with the issue memo', async () => {
+        await stake('mike', 10)
+        const lswax_supply_before = await getSupply(contracts.token_contract, 'LSWAX')
+        await contracts.dapp_contract.actions.liquify(['mike', swax(10)]).send('mike@active');
+        const lswax_supply_after = await getSupply(contracts.token_contract, 'LSWAX')
+
+        const batches = getTokenBatches()
+        assert( batches.length == 1, "expected a single batch action" )
+        const issued = batches[0].filter(o => o.op.toString() == 'issue' && o.to.toString() == 'mike')
+        assert( issued.length == 1, "expected a single issue to mike" )
+        assert( issued[0].quantity.toString() == lswax(10), "expected 10 lsWAX to be issued" )
+        assert( issued[0].memo == 'issuing lsWAX to liquify', "expected the issue memo to be kept" )
+        almost_equal( parseFloat(lswax_supply_after.supply) - parseFloat(lswax_supply_before.supply), 10 )
+    });
+
+    it('success: pending redemption request is reduced to the new balance', async () => {
+        await stake('mike', 10)
+        await incrementTime(86400)
+        await contracts.dapp_contract.actions.stakeallcpu([]).send('mike@active');
+        await incrementTime(86400)
+        await contracts.dapp_contract.actions.tgglstakeall(['dapp.fusion']).send('dapp.fusion@active');
+        await contracts.dapp_contract.actions.stakeallcpu([]).send('mike@active');
+        await contracts.dapp_contract.actions.reqredeem(['mike', swax(10), true]).send('mike@active');
+        await contracts.dapp_contract.actions.liquify(['mike', swax(4)]).send('mike@active');
+        const requests = await getRedemptionRequests('mike')
+        assert( requests.length == 1, "mike should still have 1 pending request" )
+        assert( requests[0].wax_amount_requested == wax(6), "mike's request should be reduced to 6 wax" )
+    });    
+
 });
 
 describe('\n\nliquifyexact action', () => {
@@ -1048,6 +1245,66 @@ describe('\n\nliquifyexact action', () => {
 
 });
 
+describe('\n\nmigfarms action', () => {
+
+    it('error: missing auth of self', async () => {
+        const action = contracts.dapp_contract.actions.migfarms([]).send('eosio@active');
+        await expectToThrow(action, "missing required authority dapp.fusion")        
+    }); 
+
+    it('error: there are no farms left to migrate', async () => {
+        const action = contracts.dapp_contract.actions.migfarms([]).send('dapp.fusion@active');
+        await expectToThrow(action, "eosio_assert: there are no farms left to migrate")        
+    });
+
+    it('new pairs only get rows in farms', async () => {
+        const legacy_rows = await contracts.dapp_contract.tables.lpfarms(scopes.dapp).getTableRows()
+        const farms = await getDappIncentives()
+        assert( legacy_rows.length == 0, "there should be no rows in the legacy lpfarms table" )
+        assert( farms.length == 1, "there should be 1 row in the farms table" )
+    });
+});
+
+describe('\n\nmigstakers action', () => {
+
+    it('error: missing auth of self', async () => {
+        const action = contracts.dapp_contract.actions.migstakers([0]).send('eosio@active');
+        await expectToThrow(action, "missing required authority dapp.fusion")        
+    }); 
+
+    it('error: there are no stakers left to migrate', async () => {
+        const action = contracts.dapp_contract.actions.migstakers([0]).send('dapp.fusion@active');
+        await expectToThrow(action, "eosio_assert: there are no stakers left to migrate")        
+    });
+
+    it('new stakers only get rows in stakers2', async () => {
+        await stake('mike', 10)
+        const legacy_rows = await contracts.dapp_contract.tables.stakers(scopes.dapp).getTableRows()
+        const mikes_swax = await getSWaxStaker('mike')
+        assert( legacy_rows.length == 0, "there should be no rows in the legacy stakers table" )
+        assert( mikes_swax?.swax_balance == swax(10), "mike should have 10 sWAX" )
+    });    
+});
+
+describe('\n\npruneepochs action', () => {
+
+    it('error: there are no epochs to prune', async () => {
+        const action = contracts.dapp_contract.actions.pruneepochs([0]).send('mike@active');
+        await expectToThrow(action, "eosio_assert: there are no epochs to prune")        
+    }); 
+
+    it('success: first epoch is archived after its redemption period', async () => {
+        await incrementTime(60*60*24*17)
+        await contracts.dapp_contract.actions.pruneepochs([0]).send('mike@active');
+        const epochs = await getEpochs()
+        const archive = await contracts.dapp_contract.tables.epocharchive(scopes.dapp).getTableRows()[0]
+        assert( epochs.length == 2, "should be 2 epochs left" )
+        assert( epochs[0]?.start_time == initial_state.chain_time + (86400*7), "oldest epoch should start 7 days after the first" )
+        assert( archive?.epochs_pruned == 1, "1 epoch should be archived" )
+        assert( archive?.last_pruned_epoch == initial_state.chain_time, "first epoch should be the last one pruned" )
+    });    
+});
+
 describe('\n\nreallocate action', () => {
 
     it('error: redemption period has not ended yet', async () => {
@@ -1175,6 +1432,24 @@ describe('\n\nreqredeem action', () => {
         const action = contracts.dapp_contract.actions.reqredeem(['mike', swax(10), false]).send('mike@active');
         await expectToThrow(action, `eosio_assert: you have previous requests but passed 'false' to the accept_replacing_prev_requests param`)
     }); 
+
+    it('success: replacing a request reuses the same row', async () => {
+        await stake('mike', 10)
+        await incrementTime(86400)
+        await contracts.dapp_contract.actions.stakeallcpu([]).send('mike@active');
+        await incrementTime(86400)
+        await contracts.dapp_contract.actions.tgglstakeall(['dapp.fusion']).send('dapp.fusion@active');
+        await contracts.dapp_contract.actions.stakeallcpu([]).send('mike@active');
+        await contracts.dapp_contract.actions.reqredeem(['mike', swax(10), true]).send('mike@active');
+        await contracts.dapp_contract.actions.reqredeem(['mike', swax(5), true]).send('mike@active');
+        const requests = await getRedemptionRequests('mike')
+        assert( requests.length == 1, "mike should have 1 pending request" )
+        assert( requests[0].wax_amount_requested == wax(5), "mike's request should be for 5 wax" )
+
+        const epoch_requests = await contracts.dapp_contract.tables.epochreqs(BigInt(requests[0].epoch_id)).getTableRows()
+        assert( epoch_requests.length == 1, "epoch ledger should have 1 request" )
+        assert( epoch_requests[0].wallet == 'mike' && Number(epoch_requests[0].wax_amount_requested) == 5 * 1e8, "epoch ledger should show mike's request for 5 wax" )
+    }); 
  
 });
 
@@ -1332,6 +1607,19 @@ describe('\n\nsetrentprice action', () => {
     });    
 });
 
+describe('\n\nsplitglobal action', () => {
+
+    it('error: missing auth of self', async () => {
+        const action = contracts.dapp_contract.actions.splitglobal([]).send('eosio@active');
+        await expectToThrow(action, "missing required authority dapp.fusion")        
+    }); 
+
+    it('error: there is no global singleton to migrate', async () => {
+        const action = contracts.dapp_contract.actions.splitglobal([]).send('dapp.fusion@active');
+        await expectToThrow(action, "eosio_assert: there is no global singleton to migrate")        
+    });    
+});
+
 describe('\n\nstake action', () => {
 
     it('error: missing auth of staker', async () => {
@@ -1394,6 +1682,20 @@ describe('\n\nsync action', () => {
 
     it('success', async () => {
         await contracts.dapp_contract.actions.sync(['oig']).send('oig@active');
+    });
+
+    it('success: catches up 5 years of missed epochs in one call', async () => {
+        await incrementTime(86400*365*5)
+        await contracts.dapp_contract.actions.sync(['oig']).send('oig@active');
+        const epochs = await getEpochs()
+        const state = await getDappGlobal()
+        const last_epoch = initial_state.chain_time + (86400*7*260)
+        assert( state?.last_epoch_start_time == last_epoch, "last epoch should be the 260th after the first" )
+        assert( state?.current_cpu_contract == 'cpu3.fusion', "cpu rotation should have advanced 260 times" )
+        assert( epochs.length == 5, "only the first epoch, the 3 in use, and the next one should exist" )
+        assert( epochs[1]?.start_time == last_epoch - (86400*14), "oldest created epoch should still be returnable" )
+        assert( epochs[3]?.cpu_wallet == 'cpu3.fusion', "current epoch should use cpu3.fusion" )
+        assert( epochs[4]?.cpu_wallet == 'cpu1.fusion', "next epoch should use cpu1.fusion" )
     });           
 });
 
@@ -1411,6 +1713,13 @@ describe('\n\nupdatetop21 action', () => {
         const action = contracts.dapp_contract.actions.updatetop21([]).send('mike@active');
         await expectToThrow(action, `eosio_assert: attempting to vote for 1 producers but need to vote for 16`)
     });       
+
+    it('top21 from inittop21 is sorted by name', async () => {
+        const top21 = await getDappTop21()
+        const producers = top21.block_producers.map(p => p.toString())
+        assert( producers.length >= 16, "should have voted for at least 16 producers" )
+        assert( JSON.stringify(producers) == JSON.stringify([...producers].sort()), "producers should be in string order" )
+    });
 });
 
 
@@ -1494,6 +1803,24 @@ describe('\n\nextend_reward', () => {
         almost_equal( parseFloat(r.totalRewardsPaidOut), expected_payouts )      
         assert( g.revenue_awaiting_distribution == wax(10), `there should be 0 wax awaiting distribution` )     
     }); 
+
+    it('distributing sends the POL allocation before a single batch of issues', async () => {
+        await stake('mike', 10000)
+        await contracts.wax_contract.actions.transfer(['eosio', 'dapp.fusion', wax(10), 'waxfusion_revenue']).send('eosio@active')
+        await incrementTime(86400*7)
+        await contracts.dapp_contract.actions.stake(['mike']).send('mike@active');
+
+        const batches = getTokenBatches()
+        assert( batches.length == 1, `expected a single batch action but got ${batches.length}` )
+        const issued = batches[0].filter(o => o.op.toString() == 'issue' && o.to.toString() == 'dapp.fusion')
+        assert( issued.some(o => o.quantity.toString().endsWith('LSWAX')), "expected lsWAX to be issued" )
+        assert( issued.some(o => o.quantity.toString().endsWith(' SWAX')), "expected sWAX to be issued" )
+
+        const pol_transfer_index = blockchain.actionTraces.findIndex(t => t.receiver.toString() == 'eosio.token' 
+            && t.action.toString() == 'transfer' && t.decodedData.to.toString() == 'pol.fusion')
+        const batch_index = blockchain.actionTraces.findIndex(t => t.receiver.toString() == 'token.fusion' && t.action.toString() == 'batch')
+        assert( pol_transfer_index >= 0 && pol_transfer_index < batch_index, "expected the POL allocation to be sent before the batch" )
+    });
        
 });
 
@@ -1581,4 +1908,51 @@ describe('\n\nsetincentcfg action', () => {
         assert(g2.minimum_new_incentive == lswax(150), `minimum_new_incentive should be 150 LSWAX`);
         assert(g2.new_incentive_fee == lswax(5), `new_incentive_fee should be 5 LSWAX`);
     });                     
+});
+
+
+describe('\n\ncpu contract votes', () => {
+
+    it('only revotes when top21 changes or the last vote is 7 days old', async () => {
+        await simulate_days(1, true, false)
+        await contracts.dapp_contract.actions.claimgbmvote(['cpu1.fusion']).send('mike@active');
+        const first_vote = await getCpuState('cpu1')
+        assert( Number(first_vote.last_vote_time) > 0, "cpu1 should have voted" )
+        assert( Number(first_vote.last_vote_version) == 1, "cpu1 should have voted for top21 version 1" )
+
+        await incrementTime(86400 * 2)
+        await contracts.dapp_contract.actions.claimgbmvote(['cpu1.fusion']).send('mike@active');
+        assert( !blockchain.actionTraces.some(t => t.action.toString() == 'voteproducer'), "top21 didn't change, so there should be no new vote" )
+        assert.strictEqual( Number((await getCpuState('cpu1')).last_vote_time), Number(first_vote.last_vote_time), "last_vote_time should not change" )
+
+        await incrementTime(86400 * 6)
+        await contracts.dapp_contract.actions.claimgbmvote(['cpu1.fusion']).send('mike@active');
+        assert( blockchain.actionTraces.some(t => t.action.toString() == 'voteproducer'), "last vote is stale, so it should vote again" )
+        assert( Number((await getCpuState('cpu1')).last_vote_time) > Number(first_vote.last_vote_time), "last_vote_time should be updated" )
+    });
+
+    it('error: setvotewindow missing auth of self', async () => {
+        const action = contracts.cpu1.actions.setvotewindow([86400 * 3]).send('mike@active');
+        await expectToThrow(action, "missing required authority cpu1.fusion")
+    });
+
+    it('error: setvotewindow shorter than 1 day', async () => {
+        const action = contracts.cpu1.actions.setvotewindow([86399]).send('cpu1.fusion@active');
+        await expectToThrow(action, "eosio_assert: window must be at least 1 day")
+    });
+
+    it('success: an unchanged top21 is voted again once the window has passed', async () => {
+        await contracts.cpu1.actions.setvotewindow([86400 * 3]).send('cpu1.fusion@active');
+        const state = await getCpuState('cpu1')
+        assert( Number(state.max_seconds_between_votes) == 86400 * 3, "max_seconds_between_votes should be 3 days" )
+
+        await simulate_days(1, true, false)
+        await contracts.dapp_contract.actions.claimgbmvote(['cpu1.fusion']).send('mike@active');
+        const first_vote_time = Number((await getCpuState('cpu1')).last_vote_time)
+        assert( first_vote_time > 0, "cpu1 should have voted" )
+
+        await incrementTime(86400 * 3)
+        await contracts.dapp_contract.actions.claimgbmvote(['cpu1.fusion']).send('mike@active');
+        assert( Number((await getCpuState('cpu1')).last_vote_time) > first_vote_time, "last vote is older than the window, so it should vote again" )
+    });
 });
\ No newline at end of file
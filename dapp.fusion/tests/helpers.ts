@@ -25,6 +25,17 @@ const wax = (amount) => {
     return `${parseFloat(amount).toFixed(8)} WAX`
 }
 
+//stakers2 only stores the raw amounts, convert them back to assets
+//so rows can be compared the same way as the legacy stakers table
+const staker_view = (row) => {
+    if(!row) return row;
+    return {
+        ...row,
+        swax_balance: Asset.fromUnits(row.swax_balance, '8,SWAX').toString(),
+        claimable_wax: Asset.fromUnits(row.claimable_wax, '8,WAX').toString()
+    }
+}
+
 //convert the sqrtPriceX64 from alcor into actual asset prices for tokenA and tokenB
 const sqrt64_to_price = (sqrtPriceX64) => {
 
@@ -75,6 +86,7 @@ module.exports = {
 	lswax,
     max_reward,
 	rent_cpu_memo,
+    staker_view,
 	swax,
 	wax
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 const { blockchain, contracts, incrementTime, init, initial_state, setTime, stake, simulate_days, unliquify } = require("./setup.spec.ts")
-const { almost_equal, calculate_wax_and_lswax_outputs, honey, lswax, rent_cpu_memo, swax, wax } = require("./helpers.ts")
+const { almost_equal, calculate_wax_and_lswax_outputs, honey, lswax, rent_cpu_memo, staker_view, swax, wax } = require("./helpers.ts")
 const { nameToBigInt, TimePoint, expectToThrow } = require("@eosnetwork/vert");
 const { Asset, Int64, Name, UInt64, UInt128, TimePointSec } = require('@wharfkit/antelope');
 const { assert } = require("chai");
@@ -62,9 +62,13 @@ const getBalances = async (user, contract, log = false) => {
 }
 
 const getDappGlobal = async (log = false) => {
-    const g = await contracts.dapp_contract.tables
-        .global(scopes.dapp)
+    const s = await contracts.dapp_contract.tables
+        .state(scopes.dapp)
         .getTableRows()[0]
+    const c = await contracts.dapp_contract.tables
+        .config(scopes.dapp)
+        .getTableRows()[0]
+    const g = { ...c, ...s }
     if(log){
         console.log('global:')
         console.log(g)
@@ -95,25 +99,14 @@ const getDappTop21 = async (log = false) => {
 }
 
 const getEcosystemFund = async (log = false) => {
-    const lpfarms = await contracts.dapp_contract.tables
-        .lpfarms(scopes.dapp)
-        .getTableRows()
-    if(log){
-        console.log('lpfarms:')
-        console.log(lpfarms)  
-    }
-    return lpfarms    
-}
-
-const getIncentiveIdsTable = async (log = false) => {
-    const incentiveids = await contracts.dapp_contract.tables
-        .incentiveids(scopes.dapp)
+    const farms = await contracts.dapp_contract.tables
+        .farms(scopes.dapp)
         .getTableRows()
     if(log){
-        console.log('incentiveids:')
-        console.log(incentiveids)  
+        console.log('farms:')
+        console.log(farms)  
     }
-    return incentiveids    
+    return farms    
 }
 
 const getPolConfig = async (log = false) => {
@@ -162,9 +155,9 @@ const getSupply = async (account, token, log = false) => {
 }
 
 const getSWaxStaker = async (user, log = false) => {
-    const staker = await contracts.dapp_contract.tables
-        .stakers(scopes.dapp)
-        .getTableRows(Name.from(user).value.value)[0]
+    const staker = staker_view(await contracts.dapp_contract.tables
+        .stakers2(scopes.dapp)
+        .getTableRows(Name.from(user).value.value)[0])
     if(log){
         console.log(`${user}'s SWAX:`)
         console.log(staker)
@@ -336,6 +329,16 @@ describe('\n\nrent_cpu memo', () => {
         const memo = rent_cpu_memo('mike', 1000, initial_state.chain_time)
         await contracts.wax_contract.actions.transfer(['mike', 'dapp.fusion', wax(13.2), memo]).send('mike@active') 
     });            
+
+    it('success: renting twice for the same receiver updates one row', async () => {
+        const memo = rent_cpu_memo('mike', 100, initial_state.chain_time)
+        await contracts.wax_contract.actions.transfer(['mike', 'dapp.fusion', wax(13.2), memo]).send('mike@active') 
+        await contracts.wax_contract.actions.transfer(['mike', 'dapp.fusion', wax(13.2), memo]).send('mike@active') 
+        const rentals = await contracts.dapp_contract.tables.rentals(BigInt(initial_state.chain_time)).getTableRows()
+        assert( rentals.length == 1, "there should only be 1 rental row" )
+        assert( rentals[0].renter == 'mike' && rentals[0].rent_to_account == 'mike', "rental should be from mike to mike" )
+        assert( Number(rentals[0].amount_staked) == 200 * 1e8, "rental should have 200 wax staked" )
+    });            
 });
 
 
@@ -413,6 +416,10 @@ describe('\n\nno memo / unexpected memo', () => {
         await contracts.honey_contract.actions.transfer(['mike', 'dapp.fusion', honey(10), '']).send('mike@active');
     });  
 
+    it('honey was received with a dapp memo', async () => {
+        await contracts.honey_contract.actions.transfer(['mike', 'dapp.fusion', honey(10), 'stake']).send('mike@active');
+    });  
+
     it('wax was received', async () => {
         const action = contracts.wax_contract.actions.transfer(['mike', 'dapp.fusion', wax(10), 's']).send('mike@active');
         await expectToThrow(action, err)
@@ -607,7 +614,7 @@ describe('\n\nnew_incentive memo for ecosystem farm', () => {
         await contracts.dapp_contract.actions.createfarms([]).send('mike@active');
         const alcors_lswax_before = await getBalances('swap.alcor', contracts.token_contract)   
         await contracts.token_contract.actions.transfer(['mike', 'dapp.fusion', lswax(100), '|new_incentive|2|365|']).send('mike@active');
-        const incentive_ids = await getIncentiveIdsTable()
+        const incentive_ids = await getEcosystemFund()
         const alcors_lswax_after = await getBalances('swap.alcor', contracts.token_contract)
         assert(incentive_ids[0]?.pending_boosts == lswax(100), "pending boosts should be 100 lswax")
         assert(alcors_lswax_before[0]?.balance == alcors_lswax_after[0]?.balance, "alcors lswax should not have changed")
@@ -621,14 +628,14 @@ describe('\n\nnew_incentive memo for ecosystem farm', () => {
         await contracts.dapp_contract.actions.createfarms([]).send('mike@active');
         const alcors_lswax_before = await getBalances('swap.alcor', contracts.token_contract)   
         await contracts.token_contract.actions.transfer(['mike', 'dapp.fusion', lswax(100), '|new_incentive|2|365|']).send('mike@active');
-        const incentive_ids = await getIncentiveIdsTable()
+        const incentive_ids = await getEcosystemFund()
         const global_before_extension = await getDappGlobal();
         const alcors_lswax_after = await getBalances('swap.alcor', contracts.token_contract)
         assert(incentive_ids[0]?.pending_boosts == lswax(100), "pending boosts should be 100 lswax")
         assert(alcors_lswax_before[0]?.balance == alcors_lswax_after[0]?.balance, "alcors lswax should not have changed")
         await incrementTime(86400*7)
         await contracts.dapp_contract.actions.createfarms([]).send('mike@active');
-        const incentive_ids_after = await getIncentiveIdsTable()
+        const incentive_ids_after = await getEcosystemFund()
         assert(incentive_ids_after[0]?.pending_boosts == lswax(0), "pending boosts should be 0 lswax")
         const alcors_lswax_3 = await getBalances('swap.alcor', contracts.token_contract)
         const alcor_incentives = await getAlcorIncentives()
@@ -646,4 +653,27 @@ describe('\n\nnew_incentive memo for ecosystem farm', () => {
         assert(alcors_expected_balance == parseFloat(alcors_lswax_3[0]?.balance), `alcor should have ${alcors_expected_balance} but has ${parseFloat(alcors_lswax_3[0]?.balance)}`)
         assert(expected_incentive_amount == parseFloat(alcor_incentives[0]?.reward?.quantity), `alcor should have ${expected_incentive_amount} but has ${parseFloat(alcor_incentives[0]?.reward?.quantity)}`)
     });           
-});
\ No newline at end of file
+});
+
+describe('\n\nthird party lsWAX transfers', () => {
+
+    const dappWasNotified = () => blockchain.actionTraces
+        .some(t => t.receiver.toString() == 'dapp.fusion' && t.action.toString() == 'transfer')
+
+    it('dapp.fusion is not notified when neither party is in the notifylist', async () => {
+        await stake('mike', 10, true)
+        await contracts.token_contract.actions.transfer(['mike', 'bob', lswax(1), '']).send('mike@active');
+        assert( !dappWasNotified(), "dapp.fusion should not receive the transfer notification" )
+    });
+
+    it('dapp.fusion is notified once the sender is added to the notifylist', async () => {
+        await stake('mike', 10, true)
+        await contracts.token_contract.actions.setnotify(['mike', true]).send('token.fusion@active');
+        await contracts.token_contract.actions.transfer(['mike', 'bob', lswax(1), '']).send('mike@active');
+        assert( dappWasNotified(), "dapp.fusion should receive the transfer notification" )
+
+        await contracts.token_contract.actions.setnotify(['mike', false]).send('token.fusion@active');
+        await contracts.token_contract.actions.transfer(['mike', 'bob', lswax(1), '']).send('mike@active');
+        assert( !dappWasNotified(), "dapp.fusion should stop receiving the transfer notification" )
+    });
+});
@@ -0,0 +1,226 @@
+#pragma once
+
+/** fixed_point namespace
+ *  floor(a * b / d) for the fixed point math in dapp.fusion and pol.fusion, without going through a generic wide integer type
+ *  the kernel is picked at compile time from the operand types, so a call site with operands that
+ *  are known to be 64 bits never pays for the checks and the long division that 128 bit operands need
+ *
+ *  e.g. fixed_point::mul_div( uint64_t(quantity), uint64_t(percentage), SCALE_FACTOR_1E8 )
+ */
+
+namespace fixed_point {
+
+    static constexpr uint128_t UINT128_MAX_VALUE = ~uint128_t(0);
+
+    //number of bits in an unsigned operand type
+    template<typename T>
+    static constexpr int bits_of = int(sizeof(T)) * 8;
+
+    /**
+     * floor(a * b / d) when a * b is known to fit in 128 bits
+     * `d` must not be 0
+     */
+    constexpr uint128_t mul_div_narrow(const uint128_t& a, const uint128_t& b, const uint128_t& d) {
+        return a * b / d;
+    }
+
+    /** 256 bit value as two 128 bit halves, only used as the intermediate product */
+    struct u256 {
+        uint128_t hi;
+        uint128_t lo;
+    };
+
+    /**
+     * Full 128 x 128 -> 256 bit product, schoolbook on 64 bit limbs
+     */
+    constexpr u256 mul_full(const uint128_t& a, const uint128_t& b) {
+        const uint128_t a0 = uint64_t(a);
+        const uint128_t a1 = a >> 64;
+        const uint128_t b0 = uint64_t(b);
+        const uint128_t b1 = b >> 64;
+
+        const uint128_t p00 = a0 * b0;
+        const uint128_t p01 = a0 * b1;
+        const uint128_t p10 = a1 * b0;
+        const uint128_t p11 = a1 * b1;
+
+        // at most 3 * (2^64 - 1), so this can't overflow
+        const uint128_t middle = ( p00 >> 64 ) + uint64_t(p01) + uint64_t(p10);
+
+        return u256{
+            p11 + ( p01 >> 64 ) + ( p10 >> 64 ) + ( middle >> 64 ),
+            ( middle << 64 ) | uint64_t(p00)
+        };
+    }
+
+    /**
+     * n / d for a 256 bit `n`, when the quotient is known to fit in 128 bits (n.hi < d)
+     *
+     * A 64 bit `d` is a short division, one 128 / 64 step per limb.
+     * Otherwise it's Knuth's algorithm D with a normalized 2 limb divisor,
+     * which needs 2 quotient digits.
+     */
+    constexpr uint128_t div_256_by_128(const u256& n, const uint128_t& d) {
+        constexpr uint128_t BASE = uint128_t(1) << 64;
+
+        if ( ( d >> 64 ) == 0 ) {
+            const uint64_t  limbs[4]    = { uint64_t(n.hi >> 64), uint64_t(n.hi), uint64_t(n.lo >> 64), uint64_t(n.lo) };
+            uint128_t       remainder   = 0;
+            uint128_t       quotient    = 0;
+
+            for ( int i = 0; i < 4; ++i ) {
+                const uint128_t current = ( remainder << 64 ) | limbs[i];
+                quotient    = ( quotient << 64 ) | uint64_t( current / d );
+                remainder   = current % d;
+            }
+
+            return quotient;
+        }
+
+        // normalize so the top bit of the divisor is set
+        int shift = 0;
+        while ( ( ( d << shift ) >> 127 ) == 0 ) ++shift;
+
+        const uint128_t v   = d << shift;
+        const uint128_t v1  = v >> 64;
+        const uint128_t v0  = uint64_t(v);
+
+        // u[4] is the extra top limb from the shift
+        uint64_t u[5] = {
+            uint64_t( n.lo << shift ),
+            uint64_t( ( n.lo << shift ) >> 64 ),
+            uint64_t( ( n.hi << shift ) | ( shift == 0 ? 0 : n.lo >> ( 128 - shift ) ) ),
+            uint64_t( ( ( n.hi << shift ) | ( shift == 0 ? 0 : n.lo >> ( 128 - shift ) ) ) >> 64 ),
+            uint64_t( shift == 0 ? 0 : n.hi >> ( 128 - shift ) )
+        };
+
+        uint64_t q[2] = { 0, 0 };
+
+        for ( int j = 1; j >= 0; --j ) {
+            const uint128_t top     = ( uint128_t( u[j + 2] ) << 64 ) | u[j + 1];
+            uint128_t       q_hat   = top / v1;
+            uint128_t       r_hat   = top % v1;
+
+            while ( q_hat >= BASE || q_hat * v0 > ( ( r_hat << 64 ) | u[j] ) ) {
+                --q_hat;
+                r_hat += v1;
+                if ( r_hat >= BASE ) break;
+            }
+
+            // u[j..j+2] -= q_hat * v
+            const uint128_t p0      = q_hat * v0;
+            const uint128_t p1      = q_hat * v1 + ( p0 >> 64 );
+            const uint128_t t0      = uint128_t( u[j] ) - uint64_t(p0);
+            const uint128_t t1      = uint128_t( u[j + 1] ) - uint64_t(p1) - ( t0 >> 127 );
+            const uint128_t t2      = uint128_t( u[j + 2] ) - ( p1 >> 64 ) - ( t1 >> 127 );
+
+            u[j]        = uint64_t(t0);
+            u[j + 1]    = uint64_t(t1);
+            u[j + 2]    = uint64_t(t2);
+
+            if ( ( t2 >> 127 ) != 0 ) {
+                // q_hat was one too large, add v back
+                --q_hat;
+                const uint128_t s0 = uint128_t( u[j] ) + v0;
+                const uint128_t s1 = uint128_t( u[j + 1] ) + v1 + ( s0 >> 64 );
+                u[j]        = uint64_t(s0);
+                u[j + 1]    = uint64_t(s1);
+                u[j + 2]    = uint64_t( uint128_t( u[j + 2] ) + ( s1 >> 64 ) );
+            }
+
+            q[j] = uint64_t(q_hat);
+        }
+
+        return ( uint128_t( q[1] ) << 64 ) | q[0];
+    }
+
+    /**
+     * floor(a * b / d) for any 128 bit operands, through the full 256 bit product
+     * `d` must not be 0. `overflow` is set if the result doesn't fit in 128 bits.
+     */
+    constexpr uint128_t mul_div_wide(const uint128_t& a, const uint128_t& b, const uint128_t& d, bool& overflow) {
+        const u256 product = mul_full( a, b );
+
+        overflow = product.hi >= d;
+        if ( overflow ) return 0;
+
+        return div_256_by_128( product, d );
+    }
+
+    /**
+     * floor(a * b / d), using the cheapest kernel that is correct for the operand types
+     *
+     * - 64 x 64 bits: the product always fits, so it's a single multiply and divide
+     * - 128 x 64 and 128 x 128 bits: a single multiply and divide if the product fits,
+     *   otherwise `mul_div_wide` on the full 256 bit product
+     *
+     * Throws if `d` is 0, or if the result doesn't fit in 128 bits
+     */
+    template<typename A, typename B>
+    uint128_t mul_div(const A& a, const B& b, const uint128_t& d) {
+        static_assert( A(-1) > A(0) && B(-1) > B(0), "mul_div operands must be unsigned" );
+        static_assert( bits_of<A> <= 128 && bits_of<B> <= 128, "mul_div operands can't be wider than 128 bits" );
+
+        if constexpr ( bits_of<A> < bits_of<B> ) {
+            return mul_div( b, a, d );
+        } else {
+            eosio::check( d != 0, "can not divide by 0" );
+
+            if constexpr ( bits_of<A> + bits_of<B> <= 128 ) {
+                return mul_div_narrow( a, b, d );
+            } else {
+                if ( b == 0 || uint128_t(a) <= UINT128_MAX_VALUE / b ) return mul_div_narrow( a, b, d );
+
+                bool overflow = false;
+                const uint128_t result = mul_div_wide( a, b, d, overflow );
+                eosio::check( !overflow, "mulDiv resulted in overflow" );
+                return result;
+            }
+        }
+    }
+
+    //edge cases, checked at compile time
+    namespace detail {
+        constexpr uint128_t wide(const uint128_t& a, const uint128_t& b, const uint128_t& d) {
+            bool overflow = false;
+            const uint128_t result = mul_div_wide( a, b, d, overflow );
+            return overflow ? 0 : result;
+        }
+
+        constexpr bool wide_overflows(const uint128_t& a, const uint128_t& b, const uint128_t& d) {
+            bool overflow = false;
+            mul_div_wide( a, b, d, overflow );
+            return overflow;
+        }
+
+        static constexpr uint128_t TWO_POW_64 = uint128_t(1) << 64;
+
+        constexpr uint128_t u128(const uint64_t& hi, const uint64_t& lo) {
+            return ( uint128_t(hi) << 64 ) | lo;
+        }
+    }
+
+    static_assert( mul_div_narrow( 0, 5, 3 ) == 0 );
+    static_assert( mul_div_narrow( UINT64_MAX, UINT64_MAX, UINT64_MAX ) == UINT64_MAX );
+    static_assert( mul_div_narrow( 1000, 500000, 100000000 ) == 5 );
+    static_assert( detail::wide( 0, UINT128_MAX_VALUE, 1 ) == 0 );
+    static_assert( detail::wide( UINT128_MAX_VALUE, 0, 1 ) == 0 );
+    static_assert( detail::wide( UINT128_MAX_VALUE, 1, 1 ) == UINT128_MAX_VALUE );
+    static_assert( detail::wide( UINT128_MAX_VALUE, UINT128_MAX_VALUE, UINT128_MAX_VALUE ) == UINT128_MAX_VALUE );
+    static_assert( detail::wide( UINT128_MAX_VALUE, UINT128_MAX_VALUE - 1, UINT128_MAX_VALUE ) == UINT128_MAX_VALUE - 1 );
+    static_assert( detail::wide( UINT128_MAX_VALUE - 1, UINT128_MAX_VALUE - 1, UINT128_MAX_VALUE ) == UINT128_MAX_VALUE - 2 );
+    static_assert( detail::wide( detail::TWO_POW_64, detail::TWO_POW_64, detail::TWO_POW_64 ) == detail::TWO_POW_64 );
+    static_assert( detail::wide( detail::TWO_POW_64 * 3, detail::TWO_POW_64 * 5, detail::TWO_POW_64 * 15 ) == detail::TWO_POW_64 );
+    static_assert( detail::wide( 7, 11, 3 ) == 25 );
+    static_assert( detail::wide( UINT128_MAX_VALUE, 3, 4 ) == UINT128_MAX_VALUE / 4 * 3 + 2 );
+    static_assert( detail::wide_overflows( UINT128_MAX_VALUE, 2, 1 ) );
+    static_assert( detail::wide_overflows( UINT128_MAX_VALUE, UINT128_MAX_VALUE, UINT128_MAX_VALUE - 1 ) );
+    static_assert( !detail::wide_overflows( UINT128_MAX_VALUE, 2, 2 ) );
+
+    //golden vectors, from the uintwide_t implementation this replaced in pol.fusion
+    static_assert( detail::wide( detail::u128( 1, 0x064a49dd0ee20000 ), detail::u128( 1, 0x064a49dd0ee20000 ), detail::TWO_POW_64 ) == detail::u128( 1, 0x0cbc24bf43930407 ) );
+    static_assert( detail::wide( 0xf2dc7d47f156007b, 0xf2dc7d47f156007b, detail::TWO_POW_64 ) == 0xe6659ac3953cba9f );
+    static_assert( detail::wide( detail::u128( 0x8000000000000000, 0x3039 ), detail::u128( 0x4000000000000000, 0x3e7 ), detail::u128( 0x8000000000000000, 0x7 ) ) == detail::u128( 0x4000000000000000, 0x1c00 ) );
+    static_assert( detail::wide( detail::u128( 0xfedcba9876543210, 0xfedcba9876543210 ), detail::u128( 0x0123456789abcdef, 0x0123456789abcdef ), detail::u128( 0xfedcba9876543210, 0xfedcba9876543211 ) ) == detail::u128( 0x0123456789abcdef, 0x0123456789abcdee ) );
+
+} //namespace fixed_point
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <eosio/check.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace eosio {
+
+    /**
+     * Same as `eosio::check`, but takes a callable that builds the message
+     * instead of the message itself.
+     *
+     * The callable only runs if `pred` is false, so messages that need
+     * `to_string()` or string concatenation cost nothing when the check passes.
+     *
+     *   check( quantity >= expected, [&]{ return "expected to receive " + expected.to_string(); } );
+     */
+
+    template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<MessageBuilder>>>
+    inline void check(bool pred, MessageBuilder&& build_message) {
+        if ( !pred ) check( false, build_message() );
+    }
+
+    /** `multi_index::require_find` with a lazily built message, see above */
+
+    template<typename Table, typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<MessageBuilder>>>
+    inline auto require_find(const Table& table, uint64_t primary_key, MessageBuilder&& build_message) {
+        auto itr = table.find( primary_key );
+        check( itr != table.end(), std::forward<MessageBuilder>(build_message) );
+        return itr;
+    }
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <optional>
+
+/**
+ * Singleton that is read at most once per action, and written back at most
+ * once per action (and only if the serialized row actually changed).
+ *
+ * NOTE: A new contract object is constructed for every action, so these live
+ * exactly as long as the action does. The contract's destructor (e.g. `fusion::~fusion()`)
+ * calls `flush()` on each of them after the action has finished, which is the same approach
+ * eosio.system uses for its global state. If the action fails a `check`,
+ * the destructor never runs and nothing is written.
+ *
+ * Rows are stored the same way `eosio::singleton` stores them (table and
+ * primary key are both `TableName`, the value is the packed `T`), so the
+ * `*_singleton` typedefs can still be used to read these tables. The raw
+ * db intrinsics are used directly so that we keep the bytes we loaded,
+ * and can skip `db_update_i64` when a "modified" row packs to the same bytes.
+ *
+ * Helpers should take references from `get()` / `modify()` instead of
+ * loading their own copy of the row.
+ */
+
+template<eosio::name::raw TableName, typename T>
+class lazy_singleton {
+    public:
+        lazy_singleton(eosio::name code, uint64_t scope):
+        _code(code),
+        _scope(scope),
+        _payer(code)
+        {}
+
+        bool exists() {
+            return _row.has_value() || find() >= 0;
+        }
+
+        /** Read only access, throws if the row doesn't exist */
+        const T& get() {
+            load();
+            return *_row;
+        }
+
+        /** Write access, the row will be written back when the action finishes if it changed */
+        T& modify() {
+            load();
+            _dirty = true;
+            return *_row;
+        }
+
+        /** Same as `singleton::get_or_create`, `def` only gets written if the row doesn't exist yet */
+        T& get_or_create(const eosio::name& bill_to_account, const T& def) {
+            if ( !_row.has_value() && !try_load() ) {
+                _row    = def;
+                _dirty  = true;
+                _payer  = bill_to_account;
+            }
+            return *_row;
+        }
+
+        /** Replaces the row entirely, it will be written back when the action finishes */
+        void set(const T& value, const eosio::name& bill_to_account) {
+            if ( !_row.has_value() ) try_load();
+            _row    = value;
+            _dirty  = true;
+            _payer  = bill_to_account;
+        }
+
+        void flush() {
+            if ( !_dirty ) return;
+            _dirty = false;
+
+            const std::vector<char> packed = eosio::pack( *_row );
+
+            if ( _itr >= 0 ) {
+                if ( packed == _loaded ) return;
+                eosio::internal_use_do_not_use::db_update_i64( _itr, _payer.value, packed.data(), packed.size() );
+            } else {
+                _itr = eosio::internal_use_do_not_use::db_store_i64( _scope, pk_value, _payer.value, pk_value, packed.data(), packed.size() );
+            }
+
+            _loaded = packed;
+        }
+
+    private:
+        static constexpr uint64_t   pk_value = static_cast<uint64_t>(TableName);
+
+        eosio::name         _code;
+        uint64_t            _scope;
+        eosio::name         _payer;
+        int32_t             _itr = -1;
+        std::vector<char>   _loaded;
+        std::optional<T>    _row;
+        bool                _dirty = false;
+
+        int32_t find() {
+            return eosio::internal_use_do_not_use::db_find_i64( _code.value, _scope, pk_value, pk_value );
+        }
+
+        bool try_load() {
+            _itr = find();
+            if ( _itr < 0 ) return false;
+
+            const int32_t size = eosio::internal_use_do_not_use::db_get_i64( _itr, nullptr, 0 );
+            _loaded.resize( size );
+            eosio::internal_use_do_not_use::db_get_i64( _itr, _loaded.data(), size );
+            _row = eosio::unpack<T>( _loaded.data(), _loaded.size() );
+            return true;
+        }
+
+        void load() {
+            if ( _row.has_value() ) return;
+            eosio::check( try_load(), "singleton does not exist" );
+        }
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Helpers for reading transfer memos without copying them.
+ *
+ * `memo_words` splits a memo like "|rent_cpu|receiver|100|1700000000|" on `|`.
+ * The same as the old `vector<string>` based parsers, only words that are
+ * followed by a `|` are kept, so the example above has 5 words and the first
+ * one is empty. The words are views into the memo, so the memo must outlive
+ * them. Reading past the last word returns an empty view instead of reading
+ * out of bounds. Only the first `MAX_WORDS` words are kept, anything after
+ * that is ignored rather than rejected, so callers that care about extra
+ * words need to check for them themselves.
+ *
+ * `memo_commands` is a fixed table of memo text -> command id. The table is
+ * checked at compile time for duplicate hashes, so a lookup is one hash of
+ * the input plus one string compare.
+ */
+
+namespace memo {
+
+    static constexpr char       DELIMITER       = '|';
+    static constexpr size_t     MAX_WORDS       = 8;
+
+    class memo_words {
+        public:
+            constexpr explicit memo_words(std::string_view memo) {
+                size_t start = 0;
+
+                for ( size_t i = 0; i < memo.size() && _size < MAX_WORDS; i++ ) {
+                    if ( memo[i] != DELIMITER ) continue;
+                    _words[_size++] = memo.substr( start, i - start );
+                    start = i + 1;
+                }
+            }
+
+            constexpr size_t size() const { return _size; }
+
+            constexpr std::string_view operator[](size_t index) const {
+                return index < _size ? _words[index] : std::string_view{};
+            }
+
+        private:
+            std::array<std::string_view, MAX_WORDS>     _words {};
+            size_t                                      _size = 0;
+    };
+
+    /**
+     * Parses a decimal number, stopping at the first non digit and saturating on overflow.
+     *
+     * NOTE: This replaced `std::strtoull( word.c_str(), NULL, 0 )` but is stricter:
+     * only decimal is accepted, so "0x10" is 0 and "010" is 10 rather than 8, and
+     * leading spaces, '+' or '-' aren't skipped (the result is 0).
+     */
+    constexpr uint64_t to_uint64(std::string_view word) {
+        uint64_t result = 0;
+
+        for ( char c : word ) {
+            if ( c < '0' || c > '9' ) break;
+
+            const uint64_t digit = uint64_t( c - '0' );
+            if ( result > ( UINT64_MAX - digit ) / 10 ) return UINT64_MAX;
+
+            result = result * 10 + digit;
+        }
+
+        return result;
+    }
+
+    /** FNV-1a */
+    constexpr uint32_t hash(std::string_view text) {
+        uint32_t h = 2166136261u;
+        for ( char c : text ) {
+            h ^= uint8_t(c);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    template<typename Command>
+    struct command_entry {
+        std::string_view    text;
+        Command             command;
+        uint32_t            text_hash;
+
+        constexpr command_entry(std::string_view t, Command c): text(t), command(c), text_hash(hash(t)) {}
+    };
+
+    template<typename Command, size_t N>
+    class memo_commands {
+        public:
+            constexpr memo_commands(const std::array<command_entry<Command>, N>& entries): _entries(entries) {}
+
+            constexpr bool hashes_are_unique() const {
+                for ( size_t i = 0; i < N; i++ ) {
+                    for ( size_t j = i + 1; j < N; j++ ) {
+                        if ( _entries[i].text_hash == _entries[j].text_hash ) return false;
+                    }
+                }
+                return true;
+            }
+
+            /** Returns `not_found` if `text` isn't in the table */
+            constexpr Command find(std::string_view text, Command not_found) const {
+                const uint32_t text_hash = hash( text );
+
+                for ( const auto& entry : _entries ) {
+                    if ( entry.text_hash == text_hash ) return entry.text == text ? entry.command : not_found;
+                }
+
+                return not_found;
+            }
+
+        private:
+            std::array<command_entry<Command>, N> _entries;
+    };
+
+    static_assert( memo_words("stake").size() == 0 );
+    static_assert( memo_words("|unliquify_exact|100|").size() == 3 );
+    static_assert( memo_words("|rent_cpu|someaccount|100|1700000000|")[1] == "rent_cpu" );
+    static_assert( memo_words("|rent_cpu|someaccount|100|1700000000|")[4] == "1700000000" );
+    static_assert( memo_words("|rent_cpu|")[2].empty() );
+    static_assert( to_uint64("1700000000") == 1700000000 );
+    static_assert( to_uint64("99999999999999999999") == UINT64_MAX );
+    static_assert( to_uint64("010") == 10 );
+    static_assert( to_uint64("0x10") == 0 );
+    static_assert( to_uint64(" 10") == 0 );
+    static_assert( memo_words("|1|2|3|4|5|6|7|8|9|").size() == MAX_WORDS );
+
+}
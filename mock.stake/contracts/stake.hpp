@@ -11,6 +11,7 @@
 #include <eosio/crypto.hpp>
 #include <eosio/transaction.hpp>
 #include <cmath>
+#include "../../include/memo.hpp"
 #include "constants.hpp"
 
 
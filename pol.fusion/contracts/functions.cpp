@@ -77,7 +77,7 @@ void polcontract::calculate_liquidity_allocations(  const liquidity_struct& lp_d
 {
 
     uint128_t sum_of_alcor_and_real_price   = safecast::add( uint128_t(lp_details.alcors_lswax_price), uint128_t(lp_details.real_lswax_price) );
-    uint128_t lswax_alloc_128               = mulDiv128( uint128_t(liquidity_allocation), uint128_t(lp_details.real_lswax_price), sum_of_alcor_and_real_price );
+    uint128_t lswax_alloc_128               = fixed_point::mul_div( uint64_t(liquidity_allocation), uint64_t(lp_details.real_lswax_price), sum_of_alcor_and_real_price );
     buy_lswax_allocation                    = safecast::safe_cast<int64_t>(lswax_alloc_128);
     wax_bucket_allocation                   = safecast::sub( liquidity_allocation, buy_lswax_allocation );
 }
@@ -87,7 +87,7 @@ void polcontract::calculate_liquidity_allocations(  const liquidity_struct& lp_d
  *  then calculates the lswax output amount and returns it
  */
 
-int64_t polcontract::calculate_lswax_output(const int64_t& quantity, dapp_tables::global& g) {
+int64_t polcontract::calculate_lswax_output(const int64_t& quantity, const dapp_tables::state_prefix& g) {
 
     if ( g.liquified_swax.amount == g.swax_currently_backing_lswax.amount ) {
         return quantity;
@@ -102,23 +102,22 @@ int64_t polcontract::calculate_lswax_output(const int64_t& quantity, dapp_tables
  *  then calculates the swax output amount and returns it
  */
 
-int64_t polcontract::calculate_swax_output(const int64_t& quantity, dapp_tables::global& g) {
+int64_t polcontract::calculate_swax_output(const int64_t& quantity, const dapp_tables::state_prefix& g) {
     return mulDiv( uint64_t(g.swax_currently_backing_lswax.amount), uint64_t(quantity), uint128_t(g.liquified_swax.amount) );
 }
 
 int64_t polcontract::cpu_rental_price(const uint64_t& days, const int64_t& price_per_day, const int64_t& amount) {
 
   uint128_t daily_cost      = safecast::mul( uint128_t(amount), uint128_t(price_per_day) );
-  uint128_t expected_amount = mulDiv128( daily_cost, uint128_t(days), SCALE_FACTOR_1E8 );
+  uint128_t expected_amount = fixed_point::mul_div( daily_cost, days, SCALE_FACTOR_1E8 );
   return safecast::safe_cast<int64_t>(expected_amount);
 
 }
 
 int64_t polcontract::cpu_rental_price_from_seconds(const uint64_t& seconds, const int64_t& price_per_day, const uint64_t& amount) {
   uint128_t daily_cost              = safecast::mul( uint128_t(amount), uint128_t(price_per_day) );
-  uint128_t cost_scaled_by_seconds  = safecast::mul( uint128_t(seconds), daily_cost );
-  uint128_t seconds_per_day_scaled  = safecast::mul( uint128_t(SECONDS_PER_DAY), SCALE_FACTOR_1E8 );
-  uint128_t expected_amount         = safecast::div( cost_scaled_by_seconds, seconds_per_day_scaled );
+  uint128_t seconds_per_day_scaled  = uint128_t(SECONDS_PER_DAY) * SCALE_FACTOR_1E8;
+  uint128_t expected_amount         = fixed_point::mul_div( daily_cost, seconds, seconds_per_day_scaled );
   return safecast::safe_cast<int64_t>(expected_amount);
 }
 
@@ -148,10 +147,47 @@ void polcontract::deposit_liquidity_to_alcor(const liquidity_struct& lp_details)
   ).send();
 }
 
-liquidity_struct polcontract::get_liquidity_info(config2 c, dapp_tables::global ds) {
+/**
+ * sqrt64_to_price, but reuses the prices in `pricecache` if the pool price hasn't moved
+ * 
+ * NOTE: The cache is keyed by sqrtPriceX64 itself rather than the pool's
+ * lastObservationTimestamp or the block time, since the price can change more
+ * than once per observation (or block) and a stale price would size liquidity
+ * deposits wrongly. Every notification in a block at the same pool price reuses
+ * the first decode, and the row is only rewritten when the price has moved.
+ */
+
+pool_prices polcontract::get_alcor_prices(const uint128_t& sqrtPriceX64) {
+  if ( price_cache_s.exists() ) {
+    const pricecache& pc = price_cache_s.get();
+    if ( pc.sqrtPriceX64 == sqrtPriceX64 ) return { pc.tokenA_price, pc.tokenB_price };
+  }
+
+  const pool_prices prices = sqrt64_to_price( sqrtPriceX64 );
+  price_cache_s.set( pricecache{ sqrtPriceX64, prices.tokenA, prices.tokenB }, _self );
+
+  return prices;
+}
+
+/**
+ * dapp.fusion's `config` and `state`, or the same fields from its old `global` row
+ * if `splitglobal` hasn't been run yet
+ */
+
+dapp_tables::config_prefix polcontract::get_dapp_config() {
+  if ( dapp_config_s.exists() ) return dapp_config_s.get();
+  return dapp_global_s.get().to_config();
+}
+
+dapp_tables::state_prefix polcontract::get_dapp_state() {
+  if ( dapp_state_s.exists() ) return dapp_state_s.get();
+  return dapp_global_s.get().to_state();
+}
+
+liquidity_struct polcontract::get_liquidity_info(const config2& c, const dapp_tables::state_prefix& ds) {
 
   uint64_t  poolId        = c.lswax_wax_pool_id;
-  auto      itr           = pools_t.require_find( poolId, ("could not locate pool id " + std::to_string(poolId) ).c_str() );
+  auto      itr           = require_find( pools_t, poolId, [&]{ return "could not locate pool id " + std::to_string(poolId); } );
   uint128_t sqrtPriceX64  = itr->currSlot.sqrtPriceX64;
 
   token_a_or_b poolA, poolB;
@@ -162,8 +198,8 @@ liquidity_struct polcontract::get_liquidity_info(config2 c, dapp_tables::global
   poolB = !aIsWax ? token_a_or_b{itr->tokenA.quantity.amount, WAX_SYMBOL, WAX_CONTRACT, ZERO_WAX, ZERO_WAX} : token_a_or_b{itr->tokenB.quantity.amount, LSWAX_SYMBOL, TOKEN_CONTRACT, ZERO_LSWAX, ZERO_LSWAX};
 
   int64_t               real_lswax_price    = token_price( ds.swax_currently_backing_lswax.amount, ds.liquified_swax.amount );
-  std::vector<int64_t>  alcor_prices        = sqrt64_to_price( sqrtPriceX64 );
-  int64_t               alcors_lswax_price  = aIsWax ? alcor_prices[1] : alcor_prices[0];
+  const pool_prices     alcor_prices        = get_alcor_prices( sqrtPriceX64 );
+  int64_t               alcors_lswax_price  = aIsWax ? alcor_prices.tokenB : alcor_prices.tokenA;
 
   if ( real_lswax_price < calculate_asset_share( alcors_lswax_price, 105000000 ) //real price is <= 5% higher
        &&
@@ -191,15 +227,11 @@ uint64_t polcontract::now() {
   return current_time_point().sec_since_epoch();
 }
 
-std::vector<std::string> polcontract::parse_memo(std::string memo) {
-  std::string delim = "|";
-  std::vector<std::string> words{};
-  size_t pos = 0;
-  while ((pos = memo.find(delim)) != std::string::npos) {
-    words.push_back(memo.substr(0, pos));
-    memo.erase(0, pos + delim.length());
-  }
-  return words;
+MEMO_COMMAND polcontract::get_memo_command(std::string_view memo, const memo::memo_words& words) {
+  const MEMO_COMMAND command = MEMOS.find( memo, MEMO_COMMAND::NONE );
+  if ( command != MEMO_COMMAND::NONE ) return command;
+
+  return MEMO_WORD_COMMANDS.find( words[1], MEMO_COMMAND::NONE );
 }
 
 void polcontract::stake_wax(const name& receiver, const int64_t& cpu_amount, const int64_t& net_amount) {
@@ -209,14 +241,14 @@ void polcontract::stake_wax(const name& receiver, const int64_t& cpu_amount, con
 }
 
 uint128_t polcontract::seconds_to_days_1e6(const uint64_t& seconds) {
-  return mulDiv128( uint128_t(seconds), SCALE_FACTOR_1E6, uint128_t(SECONDS_PER_DAY) );
+  return fixed_point::mul_div( seconds, uint64_t(SCALE_FACTOR_1E6), uint128_t(SECONDS_PER_DAY) );
 }
 
 //convert the sqrtPriceX64 from alcor into actual asset prices for tokenA and tokenB
-std::vector<int64_t> polcontract::sqrt64_to_price(const uint128_t& sqrtPriceX64) {
+pool_prices polcontract::sqrt64_to_price(const uint128_t& sqrtPriceX64) {
 
     uint128_t priceX64      = mulDiv128( sqrtPriceX64, sqrtPriceX64, TWO_POW_64 );
-    uint128_t P_tokenA_128  = mulDiv128( priceX64, SCALE_FACTOR_1E8, TWO_POW_64 );
+    uint128_t P_tokenA_128  = fixed_point::mul_div( priceX64, uint64_t(SCALE_FACTOR_1E8), TWO_POW_64 );
     uint128_t P_tokenB_128  = safecast::div( SCALE_FACTOR_1E16, P_tokenA_128 );
     return { safecast::safe_cast<int64_t>(P_tokenA_128), safecast::safe_cast<int64_t>(P_tokenB_128) };
 
@@ -236,29 +268,38 @@ void polcontract::transfer_tokens(const name& user, const asset& amount_to_send,
 }
 
 void polcontract::update_state() {
-  state3 s = state_s_3.get();
+  if ( now() < state_s_3.get().next_day_end_time ) return;
 
-  if ( now() >= s.next_day_end_time ) {
+  state3&   s           = state_s_3.modify();
+  uint64_t  days_passed = ( now() - s.next_day_end_time + SECONDS_PER_DAY - 1 ) / SECONDS_PER_DAY;
 
-    uint64_t days_passed = ( now() - s.next_day_end_time + SECONDS_PER_DAY - 1 ) / SECONDS_PER_DAY;
-
-    s.next_day_end_time += days_to_seconds( days_passed );
-    state_s_3.set(s, _self);
-  }
+  s.next_day_end_time += days_to_seconds( days_passed );
 }
 
 
+/**
+ * Votes for the producers in dapp.fusion's `top21`, but only if the list has
+ * changed since the last vote, or the last vote is older than config2's max_seconds_between_votes
+ */
+
 void polcontract::update_votes() {
-  state3 s = state_s_3.get();
+  const state3& s = state_s_3.get();
 
-  if ( s.last_vote_time + days_to_seconds(1) <= now() ) {
-    top21 t = top21_s.get();
-    const name no_proxy;
-    action(permission_level{get_self(), "active"_n}, "eosio"_n, "voteproducer"_n, std::tuple{ get_self(), no_proxy, t.block_producers }).send();
+  if ( s.last_vote_time + SECONDS_BETWEEN_VOTE_CHECKS > now() ) return;
 
-    s.last_vote_time = now();
-    state_s_3.set(s, _self);
-  }
+  top21 t = top21_s.get();
+  const uint64_t top21_version = t.version.value_or(0);
+  const uint64_t max_seconds_between_votes = config_s_2.get().max_seconds_between_votes.value_or(MAX_SECONDS_BETWEEN_VOTES);
+
+  const bool already_voted = s.last_vote_version.has_value() && s.last_vote_version.value() == top21_version;
+  if ( already_voted && s.last_vote_time + max_seconds_between_votes > now() ) return;
+
+  const name no_proxy;
+  action(permission_level{get_self(), "active"_n}, "eosio"_n, "voteproducer"_n, std::tuple{ get_self(), no_proxy, t.block_producers }).send();
+
+  state3& ms = state_s_3.modify();
+  ms.last_vote_time = now();
+  ms.last_vote_version.emplace(top21_version);
 }
 
 void polcontract::validate_allocations( const int64_t& quantity, const std::vector<int64_t> allocations ) {
@@ -26,6 +26,8 @@ static constexpr uint64_t MAXIMUM_WAX_TO_RENT = 1000000000000000; /* 10 Million
 static constexpr uint64_t MINIMUM_CPU_RENTAL_DAYS = 30; /* 1 Month */
 static constexpr uint64_t MINIMUM_WAX_TO_INCREASE = 10000000000; /* 100 */
 static constexpr uint64_t MINIMUM_WAX_TO_RENT = 50000000000; /* 500 */
+static constexpr uint64_t MAX_SECONDS_BETWEEN_VOTES = 60 * 60 * 24 * 7; /* default for config2, vote weight only changes weekly */
+static constexpr uint64_t SECONDS_BETWEEN_VOTE_CHECKS = 60 * 60 * 24; /* top21 is updated at most once a day */
 static constexpr uint64_t SECONDS_PER_DAY = 86400;
 
 //Scaling factors
@@ -39,3 +41,36 @@ static constexpr uint128_t SCALE_FACTOR_1E16 = 10000000000000000;
 static constexpr uint128_t SCALE_FACTOR_1E18 = 1000000000000000000;
 static constexpr uint128_t SCALE_FACTOR_1E26 = SCALE_FACTOR_1E18 * SCALE_FACTOR_1E8;
 static constexpr uint128_t SCALE_FACTOR_1E29 = SCALE_FACTOR_1E18 * SCALE_FACTOR_1E11;
+
+//Memos
+enum class MEMO_COMMAND : uint8_t {
+    NONE,
+    EXTEND_RENTAL,
+    FOR_LIQUIDITY_ONLY,
+    FOR_STAKING_POOL_ONLY,
+    INCREASE_RENTAL,
+    POL_ALLOCATION,
+    REBALANCE,
+    RENT_CPU,
+    UNSTAKE,
+    VOTER_PAY
+};
+
+// the whole memo has to match
+static constexpr memo::memo_commands<MEMO_COMMAND, 6> MEMOS({{
+    { "for liquidity only",                         MEMO_COMMAND::FOR_LIQUIDITY_ONLY },
+    { "for staking pool only",                      MEMO_COMMAND::FOR_STAKING_POOL_ONLY },
+    { "pol allocation from waxfusion distribution", MEMO_COMMAND::POL_ALLOCATION },
+    { "rebalance",                                  MEMO_COMMAND::REBALANCE },
+    { "unstake",                                    MEMO_COMMAND::UNSTAKE },
+    { "voter pay",                                  MEMO_COMMAND::VOTER_PAY }
+}});
+
+// memos with arguments, e.g. |rent_cpu|receiver|days|amount|
+static constexpr memo::memo_commands<MEMO_COMMAND, 3> MEMO_WORD_COMMANDS({{
+    { "extend_rental",      MEMO_COMMAND::EXTEND_RENTAL },
+    { "increase_rental",    MEMO_COMMAND::INCREASE_RENTAL },
+    { "rent_cpu",           MEMO_COMMAND::RENT_CPU }
+}});
+
+static_assert( MEMOS.hashes_are_unique() && MEMO_WORD_COMMANDS.hashes_are_unique() );
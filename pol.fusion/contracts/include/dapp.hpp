@@ -1,41 +1,83 @@
 #pragma once
 
+/**
+ * The parts of dapp.fusion's `state` and `config` rows that this contract uses.
+ * These are read with `singleton_prefix`, so the field order has to match
+ * the start of the real rows in dapp.fusion's `global.hpp`.
+ */
+
 namespace dapp_tables {
 
-  struct [[eosio::table]] global {
-    eosio::asset                swax_currently_earning;
-    eosio::asset                swax_currently_backing_lswax;
-    eosio::asset                liquified_swax;
-    eosio::asset                revenue_awaiting_distribution;
-    eosio::asset                total_revenue_distributed;
-    eosio::asset                wax_for_redemption;
-    uint64_t                    last_epoch_start_time;
-    eosio::asset                wax_available_for_rentals;
-    eosio::asset                cost_to_rent_1_wax;
-    eosio::name                 current_cpu_contract;
-    uint64_t                    next_stakeall_time;
-    uint64_t                    last_incentive_distribution;
-    eosio::asset                incentives_bucket;
-    eosio::asset                total_value_locked;
-    uint64_t                    total_shares_allocated;
-    uint64_t                    last_compound_time;
-    eosio::asset                minimum_stake_amount;
-    eosio::asset                minimum_unliquify_amount;
-    uint64_t                    initial_epoch_start_time;
-    uint64_t                    cpu_rental_epoch_length_seconds;
-    uint64_t                    seconds_between_epochs;
-    uint64_t                    user_share_1e6;
-    uint64_t                    pol_share_1e6;
-    uint64_t                    ecosystem_share_1e6;
-    std::vector<eosio::name>    admin_wallets;
-    std::vector<eosio::name>    cpu_contracts;
-    uint64_t                    redemption_period_length_seconds;
-    uint64_t                    seconds_between_stakeall;
-    eosio::name                 fallback_cpu_receiver;
-    uint64_t                    protocol_fee_1e6;
-    eosio::asset                total_rewards_claimed;
+  static constexpr size_t ASSET_PACKED_SIZE = sizeof(int64_t) + sizeof(uint64_t);
+
+  /** First 4 fields of `state` */
+  struct state_prefix {
+    eosio::asset    swax_currently_earning;
+    eosio::asset    swax_currently_backing_lswax;
+    eosio::asset    liquified_swax;
+    eosio::asset    wax_available_for_rentals;
+
+    static constexpr size_t packed_size = 4 * ASSET_PACKED_SIZE;
+
+    EOSLIB_SERIALIZE(state_prefix, (swax_currently_earning)
+                     (swax_currently_backing_lswax)
+                     (liquified_swax)
+                     (wax_available_for_rentals)
+                    )
+  };
+
+  /** First 3 fields of `config`, which skips the admin and cpu contract vectors */
+  struct config_prefix {
+    eosio::asset    cost_to_rent_1_wax;
+    eosio::asset    minimum_stake_amount;
+    eosio::asset    minimum_unliquify_amount;
+
+    static constexpr size_t packed_size = 3 * ASSET_PACKED_SIZE;
+
+    EOSLIB_SERIALIZE(config_prefix, (cost_to_rent_1_wax)
+                     (minimum_stake_amount)
+                     (minimum_unliquify_amount)
+                    )
+  };
+
+  /**
+   * Fixed size fields at the start of the old `global` row, which is all
+   * dapp.fusion has until its `splitglobal` action has been run.
+   * 
+   * NOTE: This lets pol.fusion be upgraded before dapp.fusion. Once `splitglobal`
+   * has run, `global` no longer exists and this is never read.
+   */
+  struct global_prefix {
+    eosio::asset    swax_currently_earning;
+    eosio::asset    swax_currently_backing_lswax;
+    eosio::asset    liquified_swax;
+    eosio::asset    revenue_awaiting_distribution;
+    eosio::asset    total_revenue_distributed;
+    eosio::asset    wax_for_redemption;
+    uint64_t        last_epoch_start_time;
+    eosio::asset    wax_available_for_rentals;
+    eosio::asset    cost_to_rent_1_wax;
+    eosio::name     current_cpu_contract;
+    uint64_t        next_stakeall_time;
+    uint64_t        last_incentive_distribution;
+    eosio::asset    incentives_bucket;
+    eosio::asset    total_value_locked;
+    uint64_t        total_shares_allocated;
+    uint64_t        last_compound_time;
+    eosio::asset    minimum_stake_amount;
+    eosio::asset    minimum_unliquify_amount;
+
+    static constexpr size_t packed_size = 12 * ASSET_PACKED_SIZE + 6 * sizeof(uint64_t);
+
+    state_prefix to_state() const {
+      return { swax_currently_earning, swax_currently_backing_lswax, liquified_swax, wax_available_for_rentals };
+    }
+
+    config_prefix to_config() const {
+      return { cost_to_rent_1_wax, minimum_stake_amount, minimum_unliquify_amount };
+    }
 
-    EOSLIB_SERIALIZE(global, (swax_currently_earning)
+    EOSLIB_SERIALIZE(global_prefix, (swax_currently_earning)
                      (swax_currently_backing_lswax)
                      (liquified_swax)
                      (revenue_awaiting_distribution)
@@ -53,21 +95,7 @@ namespace dapp_tables {
                      (last_compound_time)
                      (minimum_stake_amount)
                      (minimum_unliquify_amount)
-                     (initial_epoch_start_time)
-                     (cpu_rental_epoch_length_seconds)
-                     (seconds_between_epochs)
-                     (user_share_1e6)
-                     (pol_share_1e6)
-                     (ecosystem_share_1e6)
-                     (admin_wallets)
-                     (cpu_contracts)
-                     (redemption_period_length_seconds)
-                     (seconds_between_stakeall)
-                     (fallback_cpu_receiver)
-                     (protocol_fee_1e6)
-                     (total_rewards_claimed)
                     )
   };
-  using global_singleton = eosio::singleton<"global"_n, global>;
 
-}
\ No newline at end of file
+}
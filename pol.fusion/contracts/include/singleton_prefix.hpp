@@ -0,0 +1,50 @@
+#pragma once
+
+#include <optional>
+
+/**
+ * Read only view of the first few fields of another contract's singleton row.
+ *
+ * `T` has to be an exact prefix of the real row (same fields, same order) with
+ * a fixed packed size, declared as `T::packed_size`. Only those bytes are copied
+ * out of the row and decoded, so the rest of the row (including any vectors at
+ * the end of it) is never touched.
+ *
+ * Like `lazy_singleton`, the row is read at most once per action, and only if
+ * `get()` is actually called.
+ */
+
+template<eosio::name::raw TableName, typename T>
+class singleton_prefix {
+    public:
+        singleton_prefix(eosio::name code, uint64_t scope):
+        _code(code),
+        _scope(scope)
+        {}
+
+        bool exists() {
+            return _row.has_value() || eosio::internal_use_do_not_use::db_find_i64( _code.value, _scope, pk_value, pk_value ) >= 0;
+        }
+
+        /** Throws if the row doesn't exist, or is shorter than `T` */
+        const T& get() {
+            if ( _row.has_value() ) return *_row;
+
+            const int32_t itr = eosio::internal_use_do_not_use::db_find_i64( _code.value, _scope, pk_value, pk_value );
+            eosio::check( itr >= 0, "singleton does not exist" );
+
+            char            buffer[T::packed_size];
+            const int32_t   size = eosio::internal_use_do_not_use::db_get_i64( itr, buffer, T::packed_size );
+            eosio::check( size == int32_t(T::packed_size), "singleton row is shorter than the fields being read" );
+
+            _row = eosio::unpack<T>( buffer, T::packed_size );
+            return *_row;
+        }
+
+    private:
+        static constexpr uint64_t   pk_value = static_cast<uint64_t>(TableName);
+
+        eosio::name         _code;
+        uint64_t            _scope;
+        std::optional<T>    _row;
+};
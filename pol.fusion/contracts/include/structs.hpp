@@ -14,6 +14,16 @@ struct token_a_or_b {
     eosio::asset    amountToAdd;
 };
 
+/** pool_prices
+ *  price of tokenA in terms of tokenB and vice versa,
+ *  decoded from an alcor pool's sqrtPriceX64 and scaled by 1e8
+ */
+
+struct pool_prices {
+    int64_t         tokenA;
+    int64_t         tokenB;
+};
+
 /** liquidity_struct
  *  stores token_a_or_b structs
  *  as well as other necessary info
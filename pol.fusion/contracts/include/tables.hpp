@@ -4,10 +4,12 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] config2 {
   uint64_t      liquidity_allocation_1e6;
   uint64_t      rental_pool_allocation_1e6;
   uint64_t      lswax_wax_pool_id;
+  eosio::binary_extension<uint64_t> max_seconds_between_votes;
 
   EOSLIB_SERIALIZE(config2, (liquidity_allocation_1e6)
                           (rental_pool_allocation_1e6)
                           (lswax_wax_pool_id)
+                          (max_seconds_between_votes)
                           )
 };
 using config_singleton_2 = eosio::singleton<"config2"_n, config2>;
@@ -44,6 +46,23 @@ struct [[eosio::table]] refund_request {
 typedef eosio::multi_index< "refunds"_n, refund_request >      refunds_table;
 
 
+/**
+ * The last prices decoded from the Alcor pool, and the sqrtPriceX64 they came from
+ * 
+ * NOTE: This is its own singleton rather than a `state3` field, so it can be
+ * written without touching `state3`'s binary_extension fields.
+ */
+
+struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] pricecache {
+  uint128_t   sqrtPriceX64;
+  int64_t     tokenA_price;
+  int64_t     tokenB_price;
+
+  EOSLIB_SERIALIZE(pricecache, (sqrtPriceX64)(tokenA_price)(tokenB_price))
+};
+using price_cache_singleton = eosio::singleton<"pricecache"_n, pricecache>;
+
+
 /**
 * total bytes for a row is 560, except for the initial row which was 896
 */
@@ -78,6 +97,7 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] state3 {
   eosio::asset      wax_allocated_to_rentals;
   eosio::asset      pending_refunds;
   uint64_t          last_rebalance_time;
+  eosio::binary_extension<uint64_t> last_vote_version;
 
   EOSLIB_SERIALIZE(state3,  
                           (wax_available_for_rentals)
@@ -90,15 +110,17 @@ struct [[eosio::table, eosio::contract(CONTRACT_NAME)]] state3 {
                           (wax_allocated_to_rentals)
                           (pending_refunds)
                           (last_rebalance_time)
+                          (last_vote_version)
                           )
 };
 using state_singleton_3 = eosio::singleton<"state3"_n, state3>;
 
 
 struct [[eosio::table]] top21 {
-  std::vector<eosio::name>    block_producers;
-  uint64_t                    last_update;
+  std::vector<eosio::name>          block_producers;
+  uint64_t                          last_update;
+  eosio::binary_extension<uint64_t> version;
 
-  EOSLIB_SERIALIZE(top21, (block_producers)(last_update))
+  EOSLIB_SERIALIZE(top21, (block_producers)(last_update)(version))
 };
 using top21_singleton = eosio::singleton<"top21"_n, top21>;
\ No newline at end of file
@@ -29,19 +29,22 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
 
     update_state();
 
-    state3 s                = state_s_3.get();
-    config2 c               = config_s_2.get();
-    dapp_tables::global ds  = dapp_state_s.get();    
+    state3& s = state_s_3.modify();
 
-    if( memo == "pol allocation from waxfusion distribution" ){
+    const memo::memo_words  words   = memo::memo_words( memo );
+    const MEMO_COMMAND      command = get_memo_command( memo, words );
+
+    if( command == MEMO_COMMAND::POL_ALLOCATION ){
         check( from == DAPP_CONTRACT, "invalid sender for this memo" );
 
+        const config2& c = config_s_2.get();
+
         int64_t liquidity_allocation    = calculate_asset_share( quantity.amount, c.liquidity_allocation_1e6 );
         int64_t rental_pool_allocation  = calculate_asset_share( quantity.amount, c.rental_pool_allocation_1e6 );
         int64_t wax_bucket_allocation   = 0;
         int64_t buy_lswax_allocation    = 0;        
 
-        liquidity_struct lp_details = get_liquidity_info( c, ds );
+        liquidity_struct lp_details = get_liquidity_info( c, get_dapp_state() );
 
         if( lp_details.is_in_range ){
             calculate_liquidity_allocations( lp_details, liquidity_allocation, wax_bucket_allocation, buy_lswax_allocation );
@@ -54,52 +57,49 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
 
         s.wax_available_for_rentals.amount  = safecast::add( s.wax_available_for_rentals.amount, rental_pool_allocation );
         s.wax_bucket.amount                 = safecast::add( s.wax_bucket.amount, wax_bucket_allocation );
-        state_s_3.set(s, _self);
 
         return;
     }
 
-    if( memo == "voter pay" ){
+    if( command == MEMO_COMMAND::VOTER_PAY ){
         check( from == "eosio.voters"_n, "voter pay must come from eosio.voters" );
         transfer_tokens( DAPP_CONTRACT, quantity, WAX_CONTRACT, std::string("waxfusion_revenue") );
         return;
     }
 
     //staked CPU refund was processed and being returned
-    if( memo == "unstake" ){
+    if( command == MEMO_COMMAND::UNSTAKE ){
         check( from == "eosio.stake"_n, "unstakes should come from eosio.stake" );
 
         s.wax_available_for_rentals += quantity;
         s.pending_refunds           -= quantity;
-        state_s_3.set(s, _self);
 
         return;     
     }
 
-    if( memo == "rebalance" ){
+    if( command == MEMO_COMMAND::REBALANCE ){
 
-        check( from == DAPP_CONTRACT, ("only " + DAPP_CONTRACT.to_string() + " should send with this memo" ).c_str() );
+        check( from == DAPP_CONTRACT, [&]{ return "only " + DAPP_CONTRACT.to_string() + " should send with this memo"; } );
 
         s.wax_bucket += quantity;
 
-        liquidity_struct lp_details = get_liquidity_info( c, ds );
+        liquidity_struct lp_details = get_liquidity_info( config_s_2.get(), get_dapp_state() );
 
         if( lp_details.is_in_range && s.lswax_bucket > ZERO_LSWAX ){
             add_liquidity( s, lp_details );
             s.last_liquidity_addition_time = now();
         }
 
-        state_s_3.set(s, _self);
         return;         
     }
 
-    if( memo == "for liquidity only" ){
+    if( command == MEMO_COMMAND::FOR_LIQUIDITY_ONLY ){
 
         int64_t liquidity_allocation    = quantity.amount;
         int64_t wax_bucket_allocation   = 0;
         int64_t buy_lswax_allocation    = 0;        
 
-        liquidity_struct lp_details = get_liquidity_info( c, ds );
+        liquidity_struct lp_details = get_liquidity_info( config_s_2.get(), get_dapp_state() );
 
         if( lp_details.is_in_range ){
             calculate_liquidity_allocations( lp_details, liquidity_allocation, wax_bucket_allocation, buy_lswax_allocation );
@@ -111,22 +111,18 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
         validate_allocations( quantity.amount, {buy_lswax_allocation, wax_bucket_allocation} );
 
         s.wax_bucket.amount += wax_bucket_allocation;
-        state_s_3.set(s, _self);
 
         return;           
     }
 
-    if( memo == "for staking pool only" ){
+    if( command == MEMO_COMMAND::FOR_STAKING_POOL_ONLY ){
 
         s.wax_available_for_rentals += quantity;
-        state_s_3.set(s, _self);
 
         return;           
     }    
 
-    std::vector<std::string> words = parse_memo( memo );
-
-    if( words[1] == "rent_cpu" ){
+    if( command == MEMO_COMMAND::RENT_CPU ){
         check( tkcontract == WAX_CONTRACT, "only WAX can be sent with this memo" );
         check( words.size() >= 5, "memo for rent_cpu operation is incomplete" );
 
@@ -135,18 +131,18 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
         auto            renter_receiver_idx         = renters_t.get_index<"fromtocombo"_n>();
         const uint128_t renter_receiver_combo       = mix64to128(from.value, cpu_receiver.value);
         auto            itr                         = renter_receiver_idx.require_find(renter_receiver_combo, "you need to use the rentcpu action first");  
-        const uint64_t  days_to_rent                = std::strtoull( words[3].c_str(), NULL, 0 );
-        const uint64_t  whole_number_of_wax_to_rent = std::strtoull( words[4].c_str(), NULL, 0 );
+        const uint64_t  days_to_rent                = memo::to_uint64( words[3] );
+        const uint64_t  whole_number_of_wax_to_rent = memo::to_uint64( words[4] );
         const uint64_t  wax_amount_to_rent          = safecast::mul( whole_number_of_wax_to_rent, uint64_t(SCALE_FACTOR_1E8) );
         int64_t         amount_expected             = cpu_rental_price( days_to_rent, s.cost_to_rent_1_wax.amount, int64_t(wax_amount_to_rent) );
 
-        check( days_to_rent >= MINIMUM_CPU_RENTAL_DAYS, ( "minimum days to rent is " + std::to_string( MINIMUM_CPU_RENTAL_DAYS ) ).c_str() );
-        check( days_to_rent <= MAXIMUM_CPU_RENTAL_DAYS, ( "maximum days to rent is " + std::to_string( MAXIMUM_CPU_RENTAL_DAYS ) ).c_str() );        
-        check( whole_number_of_wax_to_rent >= safecast::div( MINIMUM_WAX_TO_RENT, uint64_t(SCALE_FACTOR_1E8) ), ("minimum wax amount to rent is " + asset( int64_t(MINIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string() ).c_str() );
-        check( whole_number_of_wax_to_rent <= safecast::div( MAXIMUM_WAX_TO_RENT, uint64_t(SCALE_FACTOR_1E8) ), ("maximum wax amount to rent is " + asset( int64_t(MAXIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string() ).c_str() );
+        check( days_to_rent >= MINIMUM_CPU_RENTAL_DAYS, [&]{ return "minimum days to rent is " + std::to_string( MINIMUM_CPU_RENTAL_DAYS ); } );
+        check( days_to_rent <= MAXIMUM_CPU_RENTAL_DAYS, [&]{ return "maximum days to rent is " + std::to_string( MAXIMUM_CPU_RENTAL_DAYS ); } );        
+        check( whole_number_of_wax_to_rent >= safecast::div( MINIMUM_WAX_TO_RENT, uint64_t(SCALE_FACTOR_1E8) ), [&]{ return "minimum wax amount to rent is " + asset( int64_t(MINIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string(); } );
+        check( whole_number_of_wax_to_rent <= safecast::div( MAXIMUM_WAX_TO_RENT, uint64_t(SCALE_FACTOR_1E8) ), [&]{ return "maximum wax amount to rent is " + asset( int64_t(MAXIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string(); } );
         check( itr->expires == 0 && itr->amount_staked.amount == 0, "memo for increasing/extending should start with extend_rental or increase_rental" );
         check( s.wax_available_for_rentals.amount >= int64_t(wax_amount_to_rent), "there is not enough wax in the rental pool to cover this rental" );
-        check( quantity.amount >= amount_expected, ("expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string() ).c_str() );
+        check( quantity.amount >= amount_expected, [&]{ return "expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string(); } );
 
         s.wax_available_for_rentals.amount  -= int64_t(wax_amount_to_rent);
         s.wax_allocated_to_rentals.amount   += int64_t(wax_amount_to_rent);
@@ -161,15 +157,13 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
 
         check( profit_made > 0, "error with rental cost calculation" );
 
-        state_s_3.set(s, _self);
-
         transfer_tokens( DAPP_CONTRACT, asset( profit_made, WAX_SYMBOL ), WAX_CONTRACT, "waxfusion_revenue" );
 
         update_votes();
         return;
     }    
 
-    if( words[1] == "extend_rental" ){
+    if( command == MEMO_COMMAND::EXTEND_RENTAL ){
         check( tkcontract == WAX_CONTRACT, "only WAX can be sent with this memo" );
         check( words.size() >= 4, "memo for extend_rental operation is incomplete" );
 
@@ -178,15 +172,15 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
         auto            renter_receiver_idx     = renters_t.get_index<"fromtocombo"_n>();
         const uint128_t renter_receiver_combo   = mix64to128(from.value, cpu_receiver.value);
         auto            itr                     = renter_receiver_idx.require_find(renter_receiver_combo, "could not locate an existing rental for this renter/receiver combo");  
-        const uint64_t  days_to_rent            = std::strtoull( words[3].c_str(), NULL, 0 );
+        const uint64_t  days_to_rent            = memo::to_uint64( words[3] );
         const int64_t   wax_amount_to_rent      = itr->amount_staked.amount;
         int64_t         amount_expected         = cpu_rental_price( days_to_rent, s.cost_to_rent_1_wax.amount, wax_amount_to_rent );
 
         check( days_to_rent >= 1, "extension must be at least 1 day" );
-        check( days_to_rent <= MAXIMUM_CPU_RENTAL_DAYS, ( "maximum days to rent is " + std::to_string( MAXIMUM_CPU_RENTAL_DAYS ) ).c_str() );
+        check( days_to_rent <= MAXIMUM_CPU_RENTAL_DAYS, [&]{ return "maximum days to rent is " + std::to_string( MAXIMUM_CPU_RENTAL_DAYS ); } );
         check( itr->expires != 0, "you can't extend a rental if it hasnt been funded yet" );
         check( itr->expires > now(), "you can't extend a rental after it expired" );
-        check( quantity.amount >= amount_expected, ("expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string() ).c_str() );
+        check( quantity.amount >= amount_expected, [&]{ return "expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string(); } );
 
         issue_refund_if_user_overpaid( from, quantity, amount_expected, profit_made );       
 
@@ -196,15 +190,13 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
 
         check( profit_made > 0, "error with rental cost calculation" );
 
-        state_s_3.set(s, _self);
-
         transfer_tokens( DAPP_CONTRACT, asset( profit_made, WAX_SYMBOL ), WAX_CONTRACT, "waxfusion_revenue" );        
 
         update_votes();
         return;
     } 
 
-    if( words[1] == "increase_rental" ){
+    if( command == MEMO_COMMAND::INCREASE_RENTAL ){
         check( tkcontract == WAX_CONTRACT, "only WAX can be sent with this memo" );
         check( words.size() >= 4, "memo for increase_rental operation is incomplete" );
         
@@ -214,14 +206,14 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
         const uint128_t renter_receiver_combo       = mix64to128(from.value, cpu_receiver.value);
         auto            itr                         = renter_receiver_idx.require_find(renter_receiver_combo, "could not locate an existing rental for this renter/receiver combo");  
         int64_t         existing_rental_amount      = itr->amount_staked.amount;
-        const uint64_t  whole_number_of_wax_to_rent = std::strtoull( words[3].c_str(), NULL, 0 );
+        const uint64_t  whole_number_of_wax_to_rent = memo::to_uint64( words[3] );
         const uint64_t  wax_amount_to_rent          = safecast::mul( whole_number_of_wax_to_rent, uint64_t(SCALE_FACTOR_1E8) );
         const int64_t   combined_wax_amount         = safecast::add( int64_t(wax_amount_to_rent), int64_t(existing_rental_amount) );
         uint64_t        seconds_remaining           = itr->expires - now();
         int64_t         amount_expected             = cpu_rental_price_from_seconds( seconds_remaining, s.cost_to_rent_1_wax.amount, wax_amount_to_rent );
 
-        check( whole_number_of_wax_to_rent >= safecast::div( MINIMUM_WAX_TO_INCREASE, uint64_t(SCALE_FACTOR_1E8) ), ("minimum wax amount to increase is " + asset( int64_t(MINIMUM_WAX_TO_INCREASE), WAX_SYMBOL ).to_string() ).c_str() );
-        check( combined_wax_amount <= int64_t(MAXIMUM_WAX_TO_RENT), ( "maximum wax amount to rent is " + asset( int64_t(MAXIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string() ).c_str() );
+        check( whole_number_of_wax_to_rent >= safecast::div( MINIMUM_WAX_TO_INCREASE, uint64_t(SCALE_FACTOR_1E8) ), [&]{ return "minimum wax amount to increase is " + asset( int64_t(MINIMUM_WAX_TO_INCREASE), WAX_SYMBOL ).to_string(); } );
+        check( combined_wax_amount <= int64_t(MAXIMUM_WAX_TO_RENT), [&]{ return "maximum wax amount to rent is " + asset( int64_t(MAXIMUM_WAX_TO_RENT), WAX_SYMBOL ).to_string(); } );
         check( itr->expires != 0, "you can't increase a rental if it hasnt been funded yet" );
         check( itr->expires > now(), "this rental has already expired" );
         check( seconds_remaining >= SECONDS_PER_DAY, "cant increase rental with < 1 day remaining" );
@@ -230,7 +222,7 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
         s.wax_available_for_rentals.amount  -= int64_t(wax_amount_to_rent);
         s.wax_allocated_to_rentals.amount   += int64_t(wax_amount_to_rent);
 
-        check( quantity.amount >= amount_expected, ("expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string() ).c_str() );
+        check( quantity.amount >= amount_expected, [&]{ return "expected to receive " + asset( amount_expected, WAX_SYMBOL ).to_string(); } );
 
         issue_refund_if_user_overpaid( from, quantity, amount_expected, profit_made );
         stake_wax( cpu_receiver, int64_t(wax_amount_to_rent), 0 );
@@ -241,8 +233,6 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
 
         check( profit_made > 0, "error with rental cost calculation" );
 
-        state_s_3.set(s, _self);
-
         transfer_tokens( DAPP_CONTRACT, asset( profit_made, WAX_SYMBOL ), WAX_CONTRACT, "waxfusion_revenue" );
 
         update_votes();
@@ -253,7 +243,6 @@ void polcontract::receive_wax_transfer(const name& from, const name& to, const a
     // Need to be 100% sure that each case above has a return statement or else this will cause issues
 
     s.wax_bucket += quantity;
-    state_s_3.set(s, _self);    
 }
 
 void polcontract::receive_lswax_transfer(const name& from, const name& to, const asset& quantity, const std::string& memo){
@@ -267,26 +256,22 @@ void polcontract::receive_lswax_transfer(const name& from, const name& to, const
 
     update_state();
 
-    state3              s   = state_s_3.get();
-    config2             c   = config_s_2.get();
-    dapp_tables::global ds  = dapp_state_s.get();    
+    state3& s = state_s_3.modify();
 
     if( memo == "liquidity" && ( from == DAPP_CONTRACT  /* || DEBUG */  ) ){
 
         s.lswax_bucket += quantity;
 
-        liquidity_struct lp_details = get_liquidity_info( c, ds );
+        liquidity_struct lp_details = get_liquidity_info( config_s_2.get(), get_dapp_state() );
 
         if( lp_details.is_in_range && s.wax_bucket > ZERO_WAX ){
             add_liquidity( s, lp_details );
             s.last_liquidity_addition_time = now();
         }
 
-        state_s_3.set(s, _self);
         return;
     }
 
     s.lswax_bucket += quantity;
-    state_s_3.set(s, _self);
 
 }
\ No newline at end of file
@@ -38,7 +38,7 @@ ACTION polcontract::claimrefund()
 ACTION polcontract::clearexpired(const int& limit)
 {
     update_state();
-    state3 s = state_s_3.get();
+    state3& s = state_s_3.modify();
 
     auto refund_itr = refunds_t.find( get_self().value );
 
@@ -81,7 +81,6 @@ ACTION polcontract::clearexpired(const int& limit)
     }
 
     check( count > 0, "no expired rentals to clear" );
-    state_s_3.set(s, _self);
 }
 
 /**
@@ -161,9 +160,10 @@ ACTION polcontract::initstate3(){
 ACTION polcontract::rebalance(){
     update_state();
 
-    state3 s                = state_s_3.get();
-    config2 c               = config_s_2.get();
-    dapp_tables::global ds  = dapp_state_s.get();    
+    state3&                             s   = state_s_3.modify();
+    const config2&                      c   = config_s_2.get();
+    const dapp_tables::state_prefix     ds  = get_dapp_state();
+    const dapp_tables::config_prefix    dc  = get_dapp_config();
 
     if( s.wax_bucket == ZERO_WAX && s.lswax_bucket == ZERO_LSWAX ){
         check(false, "there are no assets to rebalance");
@@ -183,11 +183,11 @@ ACTION polcontract::rebalance(){
             can_rebalance               =   true;
         }
 
-        if( s.lswax_bucket.amount > 0 && s.lswax_bucket >= ds.minimum_unliquify_amount && ds.wax_available_for_rentals.amount > 0 ){
+        if( s.lswax_bucket.amount > 0 && s.lswax_bucket >= dc.minimum_unliquify_amount && ds.wax_available_for_rentals.amount > 0 ){
 
             int64_t max_redeemable = calculate_lswax_output( ds.wax_available_for_rentals.amount, ds );
 
-            if( max_redeemable > ds.minimum_unliquify_amount.amount ){
+            if( max_redeemable > dc.minimum_unliquify_amount.amount ){
                 can_rebalance = true;
 
                 int64_t amount_to_transfer = std::min( s.lswax_bucket.amount, max_redeemable );
@@ -204,7 +204,6 @@ ACTION polcontract::rebalance(){
         check( can_rebalance, "can not rebalance, either due to empty buckets or dapp contract not having instant redemption funds" );
 
         s.last_rebalance_time = now();
-        state_s_3.set(s, _self);
         return;
 
     } else if( lp_details.is_in_range ){
@@ -215,20 +214,18 @@ ACTION polcontract::rebalance(){
 
             s.wax_bucket.amount     -=  amount_to_transfer;
             s.last_rebalance_time   =   now();
-            state_s_3.set(s, _self);
 
             transfer_tokens( DAPP_CONTRACT, asset( amount_to_transfer, WAX_SYMBOL), WAX_CONTRACT, std::string("wax_lswax_liquidity") );
             return; 
 
         } else if( s.lswax_bucket > ZERO_LSWAX && s.wax_bucket == ZERO_WAX ){
 
-            check( s.lswax_bucket >= ds.minimum_unliquify_amount && ds.wax_available_for_rentals.amount > 0, "can not rebalance because we're unable to instant redeem lswax for wax" );
+            check( s.lswax_bucket >= dc.minimum_unliquify_amount && ds.wax_available_for_rentals.amount > 0, "can not rebalance because we're unable to instant redeem lswax for wax" );
 
             int64_t max_redeemable = calculate_lswax_output( ds.wax_available_for_rentals.amount, ds );
 
-            check( max_redeemable > ds.minimum_unliquify_amount.amount, 
-                ( DAPP_CONTRACT.to_string() + " doesn't have enough wax in the instant redemption pool to rebalance " )
-                .c_str() );                 
+            check( max_redeemable > dc.minimum_unliquify_amount.amount, 
+                [&]{ return DAPP_CONTRACT.to_string() + " doesn't have enough wax in the instant redemption pool to rebalance "; } );                 
 
             int64_t max_output_amount   = s.lswax_bucket.amount > 0 ? calculate_swax_output( s.lswax_bucket.amount, ds ) : 0;
             int64_t max_weight          = std::min( max_output_amount, max_redeemable );
@@ -242,7 +239,6 @@ ACTION polcontract::rebalance(){
 
             s.lswax_bucket.amount -=    amount_to_transfer;
             s.last_rebalance_time =     now();
-            state_s_3.set(s, _self);
 
             transfer_tokens( DAPP_CONTRACT, asset( amount_to_transfer, LSWAX_SYMBOL), TOKEN_CONTRACT, std::string("rebalance") );
             return;             
@@ -260,7 +256,6 @@ ACTION polcontract::rebalance(){
 
                 s.wax_bucket.amount     -= amount_to_transfer;
                 s.last_rebalance_time   = now();
-                state_s_3.set(s, _self);
 
                 transfer_tokens( DAPP_CONTRACT, asset( amount_to_transfer, WAX_SYMBOL), WAX_CONTRACT, std::string("wax_lswax_liquidity") );
                 return;                                 
@@ -280,7 +275,6 @@ ACTION polcontract::rebalance(){
 
                 s.lswax_bucket.amount -=    amount_to_transfer;
                 s.last_rebalance_time =     now();
-                state_s_3.set(s, _self);
 
                 transfer_tokens( DAPP_CONTRACT, asset( amount_to_transfer, LSWAX_SYMBOL), TOKEN_CONTRACT, std::string("rebalance") );
                 return;    
@@ -306,7 +300,7 @@ ACTION polcontract::rentcpu(const name& renter, const name& cpu_receiver){
     require_auth(renter);
     update_state();
 
-    check( is_account(cpu_receiver), (cpu_receiver.to_string() + " is not a valid account").c_str() );
+    check( is_account(cpu_receiver), [&]{ return cpu_receiver.to_string() + " is not a valid account"; } );
 
     auto            renter_receiver_idx     = renters_t.get_index<"fromtocombo"_n>();
     const uint128_t renter_receiver_combo   = mix64to128(renter.value, cpu_receiver.value);
@@ -338,10 +332,9 @@ ACTION polcontract::setallocs(const uint64_t& liquidity_allocation_percent_1e6){
 
     check( liquidity_allocation_percent_1e6 >= 1000000 && liquidity_allocation_percent_1e6 <= ONE_HUNDRED_PERCENT_1E6, "percent must be between > 1e6 && <= 100 * 1e6" );
 
-    config2 c = config_s_2.get();
+    config2& c = config_s_2.modify();
     c.liquidity_allocation_1e6      = liquidity_allocation_percent_1e6;
     c.rental_pool_allocation_1e6    = ONE_HUNDRED_PERCENT_1E6 - liquidity_allocation_percent_1e6;
-    config_s_2.set(c, _self);
 }
 
 /**
@@ -361,7 +354,26 @@ ACTION polcontract::setrentprice(const asset& cost_to_rent_1_wax){
 
     check( cost_to_rent_1_wax > ZERO_WAX, "cost must be positive" );
 
-    state3 s = state_s_3.get();
+    state3& s = state_s_3.modify();
     s.cost_to_rent_1_wax = cost_to_rent_1_wax;
-    state_s_3.set(s, _self);
-}
\ No newline at end of file
+}
+/**
+ * Sets how long the same top21 vote can be kept before it is cast again
+ * 
+ * NOTE: If this has never been set, MAX_SECONDS_BETWEEN_VOTES is used.
+ * Votes are still only checked once every SECONDS_BETWEEN_VOTE_CHECKS.
+ * 
+ * Throws if the window is shorter than SECONDS_BETWEEN_VOTE_CHECKS
+ * 
+ * @param max_seconds_between_votes - the maximum age of a vote before it is refreshed
+ * 
+ * @required_auth - this contract
+ */
+
+ACTION polcontract::setvotewindow(const uint64_t& max_seconds_between_votes){
+    require_auth( _self );
+
+    check( max_seconds_between_votes >= SECONDS_BETWEEN_VOTE_CHECKS, "window must be at least 1 day" );
+
+    config_s_2.modify().max_seconds_between_votes.emplace( max_seconds_between_votes );
+}
@@ -10,14 +10,19 @@
 #include <eosio/symbol.hpp>
 #include <eosio/action.hpp>
 #include <eosio/singleton.hpp>
+#include <eosio/binary_extension.hpp>
 #include <cmath>
 #include <safecast.hpp>
+#include "../../include/fixed_point.hpp"
+#include "../../include/lazy_check.hpp"
+#include "../../include/lazy_singleton.hpp"
+#include <singleton_prefix.hpp>
 #include <tables.hpp>
 #include <alcor.hpp>
 #include <dapp.hpp>
 #include <structs.hpp>
+#include "../../include/memo.hpp"
 #include <constants.hpp>
-#include <uintwide_t.hpp>
 #include <limits>
 
 using namespace eosio;
@@ -29,11 +34,20 @@ CONTRACT polcontract : public contract {
         polcontract(name receiver, name code, datastream<const char *> ds):
         contract(receiver, code, ds),
         config_s_2(receiver, receiver.value),
+        dapp_config_s(DAPP_CONTRACT, DAPP_CONTRACT.value),
+        dapp_global_s(DAPP_CONTRACT, DAPP_CONTRACT.value),
         dapp_state_s(DAPP_CONTRACT, DAPP_CONTRACT.value),
+        price_cache_s(receiver, receiver.value),
         state_s_3(receiver, receiver.value),
         top21_s(DAPP_CONTRACT, DAPP_CONTRACT.value)
         {}
 
+        ~polcontract() {
+            config_s_2.flush();
+            price_cache_s.flush();
+            state_s_3.flush();
+        }
+
         // Main Actions
         ACTION claimgbmvote();
         ACTION claimrefund();
@@ -45,6 +59,7 @@ CONTRACT polcontract : public contract {
         ACTION rentcpu(const name& renter, const name& cpu_receiver);
         ACTION setallocs(const uint64_t& liquidity_allocation_percent_1e6);
         ACTION setrentprice(const asset& cost_to_rent_1_wax);
+        ACTION setvotewindow(const uint64_t& max_seconds_between_votes);
 
         // Notifications
         [[eosio::on_notify("eosio.token::transfer")]] void receive_wax_transfer(const name& from, const name& to, const asset& quantity, const std::string& memo);
@@ -56,33 +71,38 @@ CONTRACT polcontract : public contract {
     private:
 
         // Singletons
-        config_singleton_2              config_s_2;
-        dapp_tables::global_singleton   dapp_state_s;
-        state_singleton_3               state_s_3;
-        top21_singleton                 top21_s;
+        lazy_singleton<"config2"_n, config2>                        config_s_2;
+        singleton_prefix<"config"_n, dapp_tables::config_prefix>    dapp_config_s;
+        singleton_prefix<"global"_n, dapp_tables::global_prefix>    dapp_global_s;
+        singleton_prefix<"state"_n, dapp_tables::state_prefix>      dapp_state_s;
+        lazy_singleton<"pricecache"_n, pricecache>                  price_cache_s;
+        lazy_singleton<"state3"_n, state3>                          state_s_3;
+        top21_singleton                                             top21_s;
 
         // Multi Index Tables
         alcor_contract::pools_table pools_t     = alcor_contract::pools_table(ALCOR_CONTRACT, ALCOR_CONTRACT.value);
         refunds_table               refunds_t   = refunds_table(SYSTEM_CONTRACT, get_self().value);
         renters_table               renters_t   = renters_table(get_self(), get_self().value);
-
         // Functions
         void add_liquidity( state3& s, liquidity_struct& lp_details );
         int64_t calculate_asset_share(const int64_t& quantity, const uint64_t& percentage);
         void calculate_liquidity_allocations(const liquidity_struct& lp_details, 
             int64_t& liquidity_allocation, int64_t& wax_bucket_allocation, int64_t& buy_lswax_allocation);
-        int64_t calculate_lswax_output(const int64_t& quantity, dapp_tables::global& g);
-        int64_t calculate_swax_output(const int64_t& quantity, dapp_tables::global& g);     
+        int64_t calculate_lswax_output(const int64_t& quantity, const dapp_tables::state_prefix& g);
+        int64_t calculate_swax_output(const int64_t& quantity, const dapp_tables::state_prefix& g);     
         int64_t cpu_rental_price(const uint64_t& days, const int64_t& price_per_day, const int64_t& amount);
         int64_t cpu_rental_price_from_seconds(const uint64_t& seconds, const int64_t& price_per_day, const uint64_t& amount);
         uint64_t days_to_seconds(const uint64_t& days);
         void deposit_liquidity_to_alcor(const liquidity_struct& lp_details);
-        liquidity_struct get_liquidity_info(config2 c, dapp_tables::global ds);
+        pool_prices get_alcor_prices(const uint128_t& sqrtPriceX64);
+        dapp_tables::config_prefix get_dapp_config();
+        dapp_tables::state_prefix get_dapp_state();
+        liquidity_struct get_liquidity_info(const config2& c, const dapp_tables::state_prefix& ds);
         void issue_refund_if_user_overpaid(const name& user, const asset& quantity, int64_t& amount_expected, int64_t& profit_made);
         uint64_t now();
-        std::vector<std::string> parse_memo(std::string memo);
+        MEMO_COMMAND get_memo_command(std::string_view memo, const memo::memo_words& words);
         uint128_t seconds_to_days_1e6(const uint64_t& seconds);
-        std::vector<int64_t> sqrt64_to_price(const uint128_t& sqrtPriceX64);
+        pool_prices sqrt64_to_price(const uint128_t& sqrtPriceX64);
         void stake_wax(const name& receiver, const int64_t& cpu_amount, const int64_t& net_amount);
         int64_t token_price(const int64_t& amount_A, const int64_t& amount_B);
         void transfer_tokens(const name& user, const asset& amount_to_send, const name& contract, const std::string& memo);
@@ -92,8 +112,6 @@ CONTRACT polcontract : public contract {
         void validate_liquidity_pair(const eosio::extended_asset& a, const eosio::extended_asset& b);
 
         // Safemath
-        using uint256_t = math::wide_integer::uint256_t;
-
         int64_t mulDiv(const uint64_t& a, const uint64_t& b, const uint128_t& denominator);
         uint128_t mulDiv128(const uint128_t& a, const uint128_t& b, const uint128_t& denominator);
 };
@@ -3,7 +3,7 @@ const { nameToBigInt, TimePoint, expectToThrow } = require("@eosnetwork/vert");
 const { Asset, Int64, Name, UInt64, UInt128, TimePointSec } = require('@wharfkit/antelope');
 const { assert } = require("chai");
 const { almost_equal, calculate_lswax_to_match_wax, calculate_wax_and_lswax_outputs, calculate_wax_to_match_lswax,
-        extend_rental_memo, increase_rental_memo, rent_cpu_memo, lswax, swax, wax } = require('./helpers.ts');
+        extend_rental_memo, increase_rental_memo, rent_cpu_memo, lswax, staker_view, swax, wax } = require('./helpers.ts');
 
 const [mike, bob] = blockchain.createAccounts('mike', 'bob')
 
@@ -58,7 +58,7 @@ const getBalances = async (user, contract, log = false) => {
 
 const getDappState = async (log = false) => {
     const state = await contracts.dapp_contract.tables
-        .global(scopes.dapp)
+        .state(scopes.dapp)
         .getTableRows()[0]
     if(log){
         console.log('dapp state:')
@@ -124,9 +124,9 @@ const getSupply = async (account, token, log = false) => {
 }
 
 const getSWaxStaker = async (user) => {
-    const staker = await contracts.dapp_contract.tables
-        .stakers(scopes.dapp)
-        .getTableRows(Name.from(user).value.value)[0]
+    const staker = staker_view(await contracts.dapp_contract.tables
+        .stakers2(scopes.dapp)
+        .getTableRows(Name.from(user).value.value)[0])
     return staker; 
 }
 
@@ -669,6 +669,20 @@ describe('\n\nPOL allocation from waxfusion distribution', () => {
         almost_equal(parseFloat(alcor_pool.tokenB.quantity), 95300.0 + outputs[1]) ;
     }); 
 
+    it('pol actions still succeed after an allocation has priced the alcor pool', async () => {
+
+        await contracts.wax_contract.actions.transfer(['eosio', 'dapp.fusion', wax(1000), '']).send('eosio@active');
+        await contracts.wax_contract.actions.transfer(['dapp.fusion', 'pol.fusion', wax(1000), 'pol allocation from waxfusion distribution']).send('dapp.fusion@active');
+
+        //any later action has to be able to read and rewrite state3
+        await contracts.pol_contract.actions.setallocs([100000000]).send('pol.fusion@active');
+        await contracts.wax_contract.actions.transfer(['eosio', 'pol.fusion', wax(1000), '']).send('eosio@active');
+
+        const pol_state = await getPolState();
+        assert(parseFloat(pol_state.wax_bucket) >= 999.99999998, "expected the plain transfer in the wax bucket");
+        assert.strictEqual(pol_state.lswax_bucket, lswax(0), 'POL should have 0 LSWAX in bucket');
+    });
+
     it('when the rental_pool_allocation is 0%', async () => {
 
         //setallocs to 100000000 (100% liquidity)
@@ -695,6 +709,53 @@ describe('\n\nPOL allocation from waxfusion distribution', () => {
 });
 
 
+describe('\n\nalcor price cache', () => {
+
+    const getPriceCache = () => contracts.pol_contract.tables
+        .pricecache(scopes.pol)
+        .getTableRows()[0]
+
+    const setPriceCache = (sqrtPriceX64, tokenA_price, tokenB_price) => contracts.pol_contract.tables
+        .pricecache(scopes.pol)
+        .set(nameToBigInt('pricecache'), 'pol.fusion', { sqrtPriceX64, tokenA_price, tokenB_price })
+
+    it('decoded prices are stored with the pool price they came from', async () => {
+        await contracts.wax_contract.actions.transfer(['eosio', 'dapp.fusion', wax(1000), '']).send('eosio@active');
+        await contracts.wax_contract.actions.transfer(['dapp.fusion', 'pol.fusion', wax(1000), 'rebalance']).send('dapp.fusion@active');
+
+        const alcor_pool = await getAlcorPool()
+        const cache = getPriceCache()
+        assert( cache !== undefined, "pricecache should exist after the pool price was decoded" )
+        assert.strictEqual( String(cache.sqrtPriceX64), String(alcor_pool.currSlot.sqrtPriceX64), "pricecache should be keyed by the current pool price" )
+        assert( Number(cache.tokenA_price) > 0 && Number(cache.tokenB_price) > 0, "pricecache should hold both prices" )
+    });
+
+    it('prices are not decoded again while the pool price is unchanged', async () => {
+        const alcor_pool = await getAlcorPool()
+        setPriceCache(String(alcor_pool.currSlot.sqrtPriceX64), 1, 2)
+
+        //with an empty lswax bucket this only reads the prices, so the pool price doesn't move
+        await contracts.wax_contract.actions.transfer(['eosio', 'dapp.fusion', wax(1000), '']).send('eosio@active');
+        await contracts.wax_contract.actions.transfer(['dapp.fusion', 'pol.fusion', wax(1000), 'rebalance']).send('dapp.fusion@active');
+
+        const cache = getPriceCache()
+        assert( Number(cache.tokenA_price) == 1 && Number(cache.tokenB_price) == 2, "cached prices should have been reused" )
+    });
+
+    it('prices are decoded again once the pool price has moved', async () => {
+        setPriceCache('1', 1, 2)
+
+        await contracts.wax_contract.actions.transfer(['eosio', 'dapp.fusion', wax(1000), '']).send('eosio@active');
+        await contracts.wax_contract.actions.transfer(['dapp.fusion', 'pol.fusion', wax(1000), 'rebalance']).send('dapp.fusion@active');
+
+        const alcor_pool = await getAlcorPool()
+        const cache = getPriceCache()
+        assert.strictEqual( String(cache.sqrtPriceX64), String(alcor_pool.currSlot.sqrtPriceX64), "pricecache should be keyed by the current pool price" )
+        assert( Number(cache.tokenA_price) != 1 && Number(cache.tokenB_price) != 2, "prices should have been decoded again" )
+    });
+});
+
+
 describe('\n\ndeposit LSWAX for liquidity', () => {
 
     it('when there is 0 WAX in the bucket', async () => {
@@ -853,6 +914,26 @@ describe('\n\nsend rent_cpu memo', () => {
         const mikes_wax_balance = await getBalances('mike', contracts.wax_contract)
         assert.strictEqual(mikes_wax_balance[0].balance, wax(164), `mike should have 164 wax`);        
     });                     
+
+    it('only revotes when top21 changes or the last vote is 7 days old', async () => {
+        await contracts.wax_contract.actions.transfer(['eosio', 'pol.fusion', wax(3000), 'for staking pool only']).send('eosio@active');  
+        await contracts.wax_contract.actions.transfer(['eosio', 'mike', wax(200), '']).send('eosio@active');  
+
+        await contracts.pol_contract.actions.rentcpu(['mike', 'eosio']).send('mike@active');          
+        await contracts.wax_contract.actions.transfer(['mike', 'pol.fusion', wax(44), rent_cpu_memo( 'eosio', 30, 1000 )]).send('mike@active');  
+        const first_vote_time = Number( (await getPolState()).last_vote_time )
+        assert( first_vote_time > 0, "first rental should have voted" )
+
+        await incrementTime(86400 * 2)
+        await contracts.pol_contract.actions.rentcpu(['mike', 'bob']).send('mike@active');          
+        await contracts.wax_contract.actions.transfer(['mike', 'pol.fusion', wax(44), rent_cpu_memo( 'bob', 30, 1000 )]).send('mike@active');  
+        assert.strictEqual( Number( (await getPolState()).last_vote_time ), first_vote_time, "top21 didn't change, so there should be no new vote" )
+
+        await incrementTime(86400 * 7)
+        await contracts.pol_contract.actions.rentcpu(['mike', 'mike']).send('mike@active');          
+        await contracts.wax_contract.actions.transfer(['mike', 'pol.fusion', wax(44), rent_cpu_memo( 'mike', 30, 1000 )]).send('mike@active');  
+        assert( Number( (await getPolState()).last_vote_time ) > first_vote_time, "last vote is stale, so it should vote again" )
+    });                     
 });
 
 describe('\n\nsend extend_rental memo', () => {
@@ -1536,3 +1617,35 @@ describe('\n\nsetallocs action', () => {
         assert(pol_config.rental_pool_allocation_1e6 == 0, "liquidity_allocation should be 0%")
     });     
 });
+
+
+describe('\n\nsetvotewindow action', () => {
+
+    it('error: missing auth of self', async () => {
+        const action = contracts.pol_contract.actions.setvotewindow([86400 * 3]).send('mike@active');
+        await expectToThrow(action, "missing required authority pol.fusion");
+    });
+
+    it('error: window shorter than 1 day', async () => {
+        const action = contracts.pol_contract.actions.setvotewindow([86399]).send('pol.fusion@active');
+        await expectToThrow(action, "eosio_assert: window must be at least 1 day");
+    });
+
+    it('success: an unchanged top21 is voted again once the window has passed', async () => {
+        await contracts.pol_contract.actions.setvotewindow([86400 * 3]).send('pol.fusion@active');
+        const pol_config = await getPolConfig()
+        assert(Number(pol_config.max_seconds_between_votes) == 86400 * 3, "max_seconds_between_votes should be 3 days");
+
+        await contracts.wax_contract.actions.transfer(['eosio', 'pol.fusion', wax(3000), 'for staking pool only']).send('eosio@active');
+        await contracts.wax_contract.actions.transfer(['eosio', 'mike', wax(200), '']).send('eosio@active');
+
+        await contracts.pol_contract.actions.rentcpu(['mike', 'eosio']).send('mike@active');
+        await contracts.wax_contract.actions.transfer(['mike', 'pol.fusion', wax(44), rent_cpu_memo( 'eosio', 30, 1000 )]).send('mike@active');
+        const first_vote_time = Number( (await getPolState()).last_vote_time )
+
+        await incrementTime(86400 * 3)
+        await contracts.pol_contract.actions.rentcpu(['mike', 'bob']).send('mike@active');
+        await contracts.wax_contract.actions.transfer(['mike', 'pol.fusion', wax(44), rent_cpu_memo( 'bob', 30, 1000 )]).send('mike@active');
+        assert( Number( (await getPolState()).last_vote_time ) > first_vote_time, "last vote is older than the window, so it should vote again" )
+    });
+});
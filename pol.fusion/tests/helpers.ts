@@ -53,6 +53,17 @@ const wax = (amount) => {
     return `${parseFloat(amount).toFixed(8)} WAX`
 }
 
+//stakers2 only stores the raw amounts, convert them back to assets
+//so rows can be compared the same way as the legacy stakers table
+const staker_view = (row) => {
+    if(!row) return row;
+    return {
+        ...row,
+        swax_balance: Asset.fromUnits(row.swax_balance, '8,SWAX').toString(),
+        claimable_wax: Asset.fromUnits(row.claimable_wax, '8,WAX').toString()
+    }
+}
+
 
 module.exports = {
     almost_equal,
@@ -63,6 +74,7 @@ module.exports = {
     increase_rental_memo,
     rent_cpu_memo,
     lswax,
+    staker_view,
     swax,
     wax
 }
\ No newline at end of file
@@ -13,7 +13,7 @@ void token::create( const name&   issuer,
                     const asset&  maximum_supply )
 {
     require_auth( get_self() );
-    check( issuer == DAPP_CONTRACT, ( "issuer must be " + DAPP_CONTRACT.to_string() ).c_str() );
+    check( issuer == DAPP_CONTRACT, [&]{ return "issuer must be " + DAPP_CONTRACT.to_string(); } );
 
     auto sym = maximum_supply.symbol;
     check( sym.is_valid(), "invalid symbol name" );
@@ -33,10 +33,17 @@ void token::create( const name&   issuer,
 
 
 void token::issue( const name& issuer, const name& to, const asset& quantity, const string& memo )
+{
+    check( quantity.symbol.is_valid(), "invalid symbol name" );
+    check( memo.size() <= 256, "memo has more than 256 bytes" );
+
+    apply_issue( issuer, to, quantity );
+}
+
+void token::apply_issue( const name& issuer, const name& to, const asset& quantity )
 {
     auto sym = quantity.symbol;
     check( sym.is_valid(), "invalid symbol name" );
-    check( memo.size() <= 256, "memo has more than 256 bytes" );
 
     stats statstable( get_self(), sym.code().raw() );
     auto existing = statstable.find( sym.code().raw() );
@@ -46,11 +53,11 @@ void token::issue( const name& issuer, const name& to, const asset& quantity, co
     if(!is_account(to)){ check(false, ( to.to_string() + " is not an account" ).c_str() ); }
 
     if(quantity.symbol == SWAX_SYMBOL){
-      check( to == DAPP_CONTRACT, ("only " + DAPP_CONTRACT.to_string() + " can receive SWAX" ).c_str() );
+      check( to == DAPP_CONTRACT, [&]{ return "only " + DAPP_CONTRACT.to_string() + " can receive SWAX"; } );
     }
 
     require_auth( issuer );
-    check( issuer == DAPP_CONTRACT, ( "issuer must be " + DAPP_CONTRACT.to_string() ).c_str() );
+    check( issuer == DAPP_CONTRACT, [&]{ return "issuer must be " + DAPP_CONTRACT.to_string(); } );
     check( quantity.is_valid(), "invalid quantity" );
     check( quantity.amount > 0, "must issue positive quantity" );
 
@@ -65,10 +72,17 @@ void token::issue( const name& issuer, const name& to, const asset& quantity, co
 }
 
 void token::retire( const asset& quantity, const string& memo )
+{
+    check( quantity.symbol.is_valid(), "invalid symbol name" );
+    check( memo.size() <= 256, "memo has more than 256 bytes" );
+
+    apply_retire( quantity );
+}
+
+void token::apply_retire( const asset& quantity )
 {
     auto sym = quantity.symbol;
     check( sym.is_valid(), "invalid symbol name" );
-    check( memo.size() <= 256, "memo has more than 256 bytes" );
 
     stats statstable( get_self(), sym.code().raw() );
     auto existing = statstable.find( sym.code().raw() );
@@ -89,6 +103,24 @@ void token::retire( const asset& quantity, const string& memo )
     sub_balance( DAPP_CONTRACT, quantity );
 }
 
+void token::batch( const std::vector<token_op>& ops )
+{
+    require_auth( DAPP_CONTRACT );
+    check( ops.size() > 0, "no operations to apply" );
+
+    for( const token_op& o : ops ){
+      check( o.memo.size() <= 256, "memo has more than 256 bytes" );
+
+      if( o.op == "issue"_n ){
+        apply_issue( DAPP_CONTRACT, o.to, o.quantity );
+      } else if( o.op == "retire"_n ){
+        apply_retire( o.quantity );
+      } else {
+        check( false, "unknown operation, expected issue or retire" );
+      }
+    }
+}
+
 void token::transfer( const name&    from,
                       const name&    to,
                       const asset&   quantity,
@@ -108,7 +140,7 @@ void token::transfer( const name&    from,
     require_recipient( from );
     require_recipient( to );
 
-    if( from != DAPP_CONTRACT && to != DAPP_CONTRACT ){
+    if( should_notify_dapp( from, to ) ){
       require_recipient( DAPP_CONTRACT );
     }
 
@@ -123,6 +155,34 @@ void token::transfer( const name&    from,
     add_balance( to, quantity, payer );
 }
 
+bool token::should_notify_dapp( const name& from, const name& to )
+{
+    // dapp.fusion is already a recipient when it is one of the parties
+    if( from == DAPP_CONTRACT || to == DAPP_CONTRACT ) return false;
+
+    notify_list notify_t( get_self(), get_self().value );
+    return notify_t.find( from.value ) != notify_t.end() || notify_t.find( to.value ) != notify_t.end();
+}
+
+void token::setnotify( const name& account, const bool& notify )
+{
+    require_auth( get_self() );
+    check( is_account( account ), "account does not exist" );
+
+    notify_list notify_t( get_self(), get_self().value );
+    auto itr = notify_t.find( account.value );
+
+    if( notify ){
+      check( itr == notify_t.end(), "account is already notifying dapp.fusion" );
+      notify_t.emplace( get_self(), [&]( auto& n ){
+        n.account = account;
+      });
+    } else {
+      check( itr != notify_t.end(), "account is not notifying dapp.fusion" );
+      notify_t.erase( itr );
+    }
+}
+
 void token::sub_balance( const name& owner, const asset& value ) {
    accounts from_acnts( get_self(), owner.value );
 
@@ -5,6 +5,8 @@
 
 #include <string>
 
+#include "../../include/lazy_check.hpp"
+
 namespace eosiosystem {
    class system_contract;
 }
@@ -13,6 +15,23 @@ namespace eosio {
 
    using std::string;
 
+   /**
+    * A single operation inside a `batch` action.
+    *
+    * @param op - `issue` or `retire`
+    * @param to - the account to issue to, ignored for `retire`
+    * @param quantity - the quantity of tokens to issue or retire
+    * @param memo - the memo the matching `issue`/`retire` action would have used
+    */
+   struct token_op {
+      name     op;
+      name     to;
+      asset    quantity;
+      string   memo;
+
+      EOSLIB_SERIALIZE( token_op, (op)(to)(quantity)(memo) )
+   };
+
    /**
     * The `eosio.token` sample system contract defines the structures and actions that allow users to create, issue, and manage tokens for EOSIO based blockchains. It demonstrates one way to implement a smart contract which allows for creation and management of tokens. It is possible for one to create a similar contract which suits different needs. However, it is recommended that if one only needs a token with the below listed actions, that one uses the `eosio.token` contract instead of developing their own.
     * 
@@ -60,6 +79,19 @@ namespace eosio {
          [[eosio::action]]
          void retire( const asset& quantity, const string& memo );
 
+         /**
+          * Applies several `issue`/`retire` operations from `dapp.fusion` in one action,
+          * so that a single dapp.fusion action only needs one inline action to this contract.
+          *
+          * Each operation goes through the same checks as the `issue`/`retire` actions.
+          * Transfers are intentionally not supported here, because the receiving contracts
+          * (pol.fusion, Alcor) act on the `transfer` notification, which a batch can't produce.
+          *
+          * @param ops - the operations to apply, in order.
+          */
+         [[eosio::action]]
+         void batch( const std::vector<token_op>& ops );
+
          /**
           * Allows `from` account to transfer to `to` account the `quantity` tokens.
           * One account is debited and the other is credited with quantity tokens.
@@ -74,6 +106,26 @@ namespace eosio {
                         const name&    to,
                         const asset&   quantity,
                         const string&  memo );
+         /**
+          * Adds or removes `account` from the list of accounts whose transfers are
+          * forwarded to `dapp.fusion` as a notification.
+          *
+          * Transfers to and from `dapp.fusion` itself always reach it, since it is
+          * `from` or `to`. Other transfers used to notify it unconditionally, which
+          * cost a full dispatch into dapp.fusion on every DEX swap and wallet move,
+          * only for `receive_lswax_transfer` to return because `to != get_self()`.
+          *
+          * Security: a notification can't move balances or reject anything dapp.fusion
+          * doesn't already reject, and dapp.fusion only accounts for deposits where it is
+          * the receiver. Leaving an account out of this list therefore can't be used to
+          * hide a deposit from it. Only this contract's own permission can edit the list.
+          *
+          * @param account - the account to add or remove,
+          * @param notify - `true` to forward its transfers, `false` to stop.
+          */
+         [[eosio::action]]
+         void setnotify( const name& account, const bool& notify );
+
          /**
           * Allows `ram_payer` to create an account `owner` with zero balance for
           * token `symbol` at the expense of `ram_payer`.
@@ -118,7 +170,9 @@ namespace eosio {
          using create_action = eosio::action_wrapper<"create"_n, &token::create>;
          using issue_action = eosio::action_wrapper<"issue"_n, &token::issue>;
          using retire_action = eosio::action_wrapper<"retire"_n, &token::retire>;
+         using batch_action = eosio::action_wrapper<"batch"_n, &token::batch>;
          using transfer_action = eosio::action_wrapper<"transfer"_n, &token::transfer>;
+         using setnotify_action = eosio::action_wrapper<"setnotify"_n, &token::setnotify>;
          using open_action = eosio::action_wrapper<"open"_n, &token::open>;
          using close_action = eosio::action_wrapper<"close"_n, &token::close>;
       private:
@@ -136,9 +190,19 @@ namespace eosio {
             uint64_t primary_key()const { return supply.symbol.code().raw(); }
          };
 
+         struct [[eosio::table]] notify_account {
+            name     account;
+
+            uint64_t primary_key()const { return account.value; }
+         };
+
          typedef eosio::multi_index< "accounts"_n, account > accounts;
          typedef eosio::multi_index< "stat"_n, currency_stats > stats;
+         typedef eosio::multi_index< "notifylist"_n, notify_account > notify_list;
 
+         void apply_issue( const name& issuer, const name& to, const asset& quantity );
+         void apply_retire( const asset& quantity );
+         bool should_notify_dapp( const name& from, const name& to );
          void sub_balance( const name& owner, const asset& value );
          void add_balance( const name& owner, const asset& value, const name& ram_payer );
    };